@@ -1,9 +1,14 @@
 #include "connection.h"
+#include "bitstring.h"
 
 #include <grpc/support/time.h>
 #include <grpcpp/create_channel.h>
 #include <grpcpp/security/credentials.h>
+#include <grpcpp/support/channel_arguments.h>
 
+#include <google/protobuf/io/coded_stream.h>
+
+#include <algorithm>
 #include <iostream>
 #include <stdexcept>
 
@@ -36,11 +41,42 @@ void WriteRequest::addUpdate(p4::v1::Update_Type type, std::unique_ptr<p4::v1::E
 // SwitchConnection //
 //////////////////////
 
+/// \brief Result of the requests split from the same WriteRequest. Updated by the completion
+/// thread only.
+struct SwitchConnection::WriteBatch
+{
+    size_t remaining = 0;
+    bool success = true;
+    std::promise<bool> promise;
+    WriteCallback callback;
+};
+
+/// \brief State of a Write RPC in flight. The completion queue tag.
+struct SwitchConnection::PendingWrite
+{
+    grpc::ClientContext ctx;
+    p4::v1::WriteResponse response;
+    grpc::Status status;
+    std::unique_ptr<grpc::ClientAsyncResponseReader<p4::v1::WriteResponse>> reader;
+    std::shared_ptr<WriteBatch> batch;
+};
+
 SwitchConnection::SwitchConnection(
-    const grpc::string& address, DeviceId deviceId, ElectionId electionId)
-    : deviceId(deviceId), electionId(electionId)
+    const grpc::string& address, DeviceId deviceId, ElectionId electionId,
+    const WriteConfig& writeConfig, const ReconnectConfig& reconnectConfig)
+    : deviceId(deviceId), electionId(electionId), writeConfig(writeConfig)
+    , reconnectConfig(reconnectConfig)
 {
-    channel = grpc::CreateChannel(address, grpc::InsecureChannelCredentials());
+    // gRPC reconnects the channel in the background, by default it waits up to two minutes
+    // between attempts
+    grpc::ChannelArguments args;
+    args.SetInt(GRPC_ARG_INITIAL_RECONNECT_BACKOFF_MS,
+        static_cast<int>(reconnectConfig.minBackoff.count()));
+    args.SetInt(GRPC_ARG_MIN_RECONNECT_BACKOFF_MS,
+        static_cast<int>(reconnectConfig.minBackoff.count()));
+    args.SetInt(GRPC_ARG_MAX_RECONNECT_BACKOFF_MS,
+        static_cast<int>(reconnectConfig.maxBackoff.count()));
+    channel = grpc::CreateCustomChannel(address, grpc::InsecureChannelCredentials(), args);
     auto t = gpr_time_add(gpr_now(GPR_CLOCK_REALTIME),
         gpr_time_from_seconds(10, GPR_TIMESPAN));
     if (!channel->WaitForConnected(t))
@@ -49,6 +85,61 @@ SwitchConnection::SwitchConnection(
     stub = p4::v1::P4Runtime::NewStub(channel);
     streamClientCtx = std::make_unique<grpc::ClientContext>();
     stream = stub->StreamChannel(streamClientCtx.get());
+    writeThread = std::thread(&SwitchConnection::completeWrites, this);
+    ackThread = std::thread(&SwitchConnection::sendDigestAcks, this);
+    if (reconnectConfig.keepaliveInterval.count())
+        keepaliveThread = std::thread(&SwitchConnection::probeLiveness, this);
+}
+
+SwitchConnection::~SwitchConnection()
+{
+    {
+        std::lock_guard<std::mutex> lock(keepaliveMutex);
+        stopKeepalive = true;
+    }
+    keepaliveCond.notify_all();
+    if (keepaliveThread.joinable())
+        keepaliveThread.join();
+
+    waitForWrites();
+    writeQueue.Shutdown();
+    if (writeThread.joinable())
+        writeThread.join();
+
+    // Write callbacks may have queued acknowledgements until now
+    {
+        std::lock_guard<std::mutex> lock(ackMutex);
+        stopAcks = true;
+    }
+    ackCond.notify_all();
+    if (ackThread.joinable())
+        ackThread.join();
+}
+
+bool SwitchConnection::reopenStream(std::chrono::milliseconds timeout)
+{
+    {
+        std::lock_guard<std::mutex> lock(streamWriteMutex);
+        if (stream)
+        {
+            streamClientCtx->TryCancel();
+            auto status = stream->Finish();
+            if (!status.ok())
+                std::cout << "Stream closed: " << status.error_message() << std::endl;
+            stream.reset();
+        }
+    }
+
+    auto deadline = std::chrono::system_clock::now() + timeout;
+    if (!channel->WaitForConnected(deadline))
+        return false;
+
+    auto ctx = std::make_unique<grpc::ClientContext>();
+    auto newStream = stub->StreamChannel(ctx.get());
+    std::lock_guard<std::mutex> lock(streamWriteMutex);
+    streamClientCtx = std::move(ctx);
+    stream = std::move(newStream);
+    return true;
 }
 
 bool SwitchConnection::sendMasterArbitrationUpdate()
@@ -61,10 +152,12 @@ bool SwitchConnection::sendMasterArbitrationUpdate()
     auto election = arbUpdate->mutable_election_id();
     election->set_high(0);
     election->set_low(electionId);
-    return stream->Write(request);
+    std::lock_guard<std::mutex> lock(streamWriteMutex);
+    return stream && stream->Write(request);
 }
 
-bool SwitchConnection::setPipelineConfig(const P4Info& p4Info, const DeviceConfig& deviceConfig)
+bool SwitchConnection::setPipelineConfig(const P4Info& p4Info, const DeviceConfig& deviceConfig,
+    uint64_t cookie, p4::v1::SetForwardingPipelineConfigRequest::Action action)
 {
     using PipelineConfigRequest = p4::v1::SetForwardingPipelineConfigRequest;
 
@@ -73,10 +166,12 @@ bool SwitchConnection::setPipelineConfig(const P4Info& p4Info, const DeviceConfi
     auto election = request.mutable_election_id();
     election->set_high(0);
     election->set_low(electionId);
-    request.set_action(PipelineConfigRequest::VERIFY_AND_COMMIT);
+    request.set_action(action);
     auto config = request.mutable_config();
     *config->mutable_p4info() = p4Info;
     config->set_p4_device_config(deviceConfig.data(), deviceConfig.size());
+    if (cookie)
+        config->mutable_cookie()->set_cookie(cookie);
 
     grpc::ClientContext ctx;
     p4::v1::SetForwardingPipelineConfigResponse response;
@@ -86,6 +181,28 @@ bool SwitchConnection::setPipelineConfig(const P4Info& p4Info, const DeviceConfi
     return status.ok();
 }
 
+bool SwitchConnection::getPipelineCookie(uint64_t& cookie)
+{
+    using PipelineConfigRequest = p4::v1::GetForwardingPipelineConfigRequest;
+
+    PipelineConfigRequest request;
+    request.set_device_id(deviceId);
+    request.set_response_type(PipelineConfigRequest::COOKIE_ONLY);
+
+    grpc::ClientContext ctx;
+    p4::v1::GetForwardingPipelineConfigResponse response;
+    grpc::Status status = stub->GetForwardingPipelineConfig(&ctx, request, &response);
+    if (!status.ok())
+    {
+        // A switch without a pipeline answers with FAILED_PRECONDITION
+        if (status.error_code() != grpc::StatusCode::FAILED_PRECONDITION)
+            std::cout << "Reading pipeline config failed: " << status.error_message() << std::endl;
+        return false;
+    }
+    cookie = response.config().has_cookie() ? response.config().cookie().cookie() : 0;
+    return true;
+}
+
 bool SwitchConnection::sendWriteRequest(const WriteRequest &request)
 {
     grpc::ClientContext ctx;
@@ -96,11 +213,266 @@ bool SwitchConnection::sendWriteRequest(const WriteRequest &request)
     return status.ok();
 }
 
+std::future<bool> SwitchConnection::sendWriteRequestAsync(
+    WriteRequest request, WriteCallback callback)
+{
+    auto parts = splitWriteRequest(std::move(request.request));
+    auto batch = std::make_shared<WriteBatch>();
+    batch->remaining = parts.size();
+    batch->callback = std::move(callback);
+    auto future = batch->promise.get_future();
+
+    for (auto& part : parts)
+    {
+        {
+            std::unique_lock<std::mutex> lock(writeMutex);
+            writeCond.wait(lock, [this] { return writesInFlight < writeConfig.maxInFlight; });
+            ++writesInFlight;
+        }
+        auto write = std::make_unique<PendingWrite>();
+        write->batch = batch;
+        write->reader = stub->AsyncWrite(&write->ctx, *part, &writeQueue);
+        // The completion thread takes ownership of the write
+        auto tag = write.release();
+        tag->reader->Finish(&tag->response, &tag->status, tag);
+    }
+    return future;
+}
+
+void SwitchConnection::waitForWrites()
+{
+    std::unique_lock<std::mutex> lock(writeMutex);
+    writeCond.wait(lock, [this] { return writesInFlight == 0; });
+}
+
+/// \brief Split a write request into requests not larger than WriteConfig::maxRequestBytes.
+/// \details The updates keep their order. An update larger than the limit is sent on its own.
+std::vector<std::unique_ptr<p4::v1::WriteRequest>> SwitchConnection::splitWriteRequest(
+    std::unique_ptr<p4::v1::WriteRequest> request) const
+{
+    using google::protobuf::io::CodedOutputStream;
+
+    std::vector<std::unique_ptr<p4::v1::WriteRequest>> parts;
+    if (request->ByteSizeLong() <= writeConfig.maxRequestBytes)
+    {
+        parts.push_back(std::move(request));
+        return parts;
+    }
+
+    auto updates = request->mutable_updates();
+    auto header = std::make_unique<p4::v1::WriteRequest>(*request);
+    header->clear_updates();
+    size_t headerBytes = header->ByteSizeLong();
+
+    std::unique_ptr<p4::v1::WriteRequest> part;
+    size_t partBytes = 0;
+    for (auto& update : *updates)
+    {
+        // Tag and length prefix of the embedded message
+        size_t updateSize = update.ByteSizeLong();
+        size_t updateBytes = 1 + CodedOutputStream::VarintSize64(updateSize) + updateSize;
+        if (part && partBytes + updateBytes > writeConfig.maxRequestBytes)
+            parts.push_back(std::move(part));
+        if (!part)
+        {
+            part = std::make_unique<p4::v1::WriteRequest>(*header);
+            partBytes = headerBytes;
+        }
+        part->add_updates()->Swap(&update);
+        partBytes += updateBytes;
+    }
+    if (part)
+        parts.push_back(std::move(part));
+    return parts;
+}
+
+/// \brief Handle completed Write RPCs until the completion queue is shut down.
+void SwitchConnection::completeWrites()
+{
+    void* tag = nullptr;
+    bool ok = false;
+    while (writeQueue.Next(&tag, &ok))
+    {
+        std::unique_ptr<PendingWrite> write(static_cast<PendingWrite*>(tag));
+        bool success = ok && write->status.ok();
+        if (!success)
+            std::cout << "Write request failed: " << write->status.error_message() << std::endl;
+
+        auto& batch = *write->batch;
+        batch.success = batch.success && success;
+        if (--batch.remaining == 0)
+        {
+            if (batch.callback)
+                batch.callback(batch.success);
+            batch.promise.set_value(batch.success);
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(writeMutex);
+            --writesInFlight;
+        }
+        writeCond.notify_all();
+    }
+}
+
+bool SwitchConnection::sendReadRequest(
+    const p4::v1::Entity& entity, std::vector<p4::v1::Entity>& entities)
+{
+    return sendReadRequest(std::span(&entity, 1),
+        [&entities](const p4::v1::Entity& e) { entities.push_back(e); });
+}
+
+bool SwitchConnection::sendReadRequest(
+    std::span<const p4::v1::Entity> entities, const ReadVisitor& visitor)
+{
+    p4::v1::ReadRequest request;
+    request.set_device_id(deviceId);
+    request.mutable_entities()->Reserve(static_cast<int>(entities.size()));
+    for (const auto& entity : entities)
+        *request.add_entities() = entity;
+
+    grpc::ClientContext ctx;
+    auto reader = stub->Read(&ctx, request);
+    // The response is reused for every message of the stream, so its entities are only allocated
+    // once
+    p4::v1::ReadResponse response;
+    while (reader->Read(&response))
+    {
+        for (const auto& e : response.entities())
+            visitor(e);
+    }
+    grpc::Status status = reader->Finish();
+    if (!status.ok())
+        std::cout << "Read request failed: " << status.error_message() << std::endl;
+    return status.ok();
+}
+
+bool SwitchConnection::readCounters(std::span<const CounterReadout> counters)
+{
+    std::vector<p4::v1::Entity> entities(counters.size());
+    for (size_t i = 0; i < counters.size(); ++i)
+        entities[i].mutable_counter_entry()->set_counter_id(counters[i].counterId);
+
+    // Cells of a counter arrive in a row, so the readout of the previous cell usually matches
+    size_t last = 0;
+    return sendReadRequest(entities, [&counters, &last](const p4::v1::Entity& entity) {
+        const auto& entry = entity.counter_entry();
+        if (last >= counters.size() || counters[last].counterId != entry.counter_id())
+        {
+            last = std::find_if(counters.begin(), counters.end(), [&entry](const auto& c) {
+                return c.counterId == entry.counter_id();
+            }) - counters.begin();
+            if (last == counters.size())
+                return;
+        }
+        const auto& readout = counters[last];
+        auto index = entry.index().index();
+        if (index < 0)
+            return;
+        if (static_cast<size_t>(index) < readout.bytes.size())
+            readout.bytes[index] = entry.data().byte_count();
+        if (static_cast<size_t>(index) < readout.packets.size())
+            readout.packets[index] = entry.data().packet_count();
+    });
+}
+
+bool SwitchConnection::readRegisters(std::span<const RegisterReadout> registers)
+{
+    std::vector<p4::v1::Entity> entities(registers.size());
+    for (size_t i = 0; i < registers.size(); ++i)
+        entities[i].mutable_register_entry()->set_register_id(registers[i].registerId);
+
+    size_t last = 0;
+    return sendReadRequest(entities, [&registers, &last](const p4::v1::Entity& entity) {
+        const auto& entry = entity.register_entry();
+        if (last >= registers.size() || registers[last].registerId != entry.register_id())
+        {
+            last = std::find_if(registers.begin(), registers.end(), [&entry](const auto& r) {
+                return r.registerId == entry.register_id();
+            }) - registers.begin();
+            if (last == registers.size())
+                return;
+        }
+        const auto& readout = registers[last];
+        auto index = entry.index().index();
+        if (index >= 0 && static_cast<size_t>(index) < readout.values.size())
+            readout.values[index] = fromBitstring<8, uint64_t>(entry.data().bitstring());
+    });
+}
+
 bool SwitchConnection::ackDigestList(uint32_t digestId, uint64_t listId)
 {
     p4::v1::StreamMessageRequest request;
     auto digestAck = request.mutable_digest_ack();
     digestAck->set_digest_id(digestId);
     digestAck->set_list_id(listId);
-    return stream->Write(request);
+    std::lock_guard<std::mutex> lock(streamWriteMutex);
+    return stream && stream->Write(request);
+}
+
+void SwitchConnection::queueDigestAck(uint32_t digestId, uint64_t listId)
+{
+    {
+        std::lock_guard<std::mutex> lock(ackMutex);
+        pendingAcks.emplace_back(digestId, listId);
+    }
+    ackCond.notify_one();
+}
+
+/// \brief Send queued digest acknowledgements until the connection is destroyed.
+void SwitchConnection::sendDigestAcks()
+{
+    std::vector<std::pair<uint32_t, uint64_t>> acks;
+    std::unique_lock<std::mutex> lock(ackMutex);
+    while (true)
+    {
+        ackCond.wait(lock, [this] { return stopAcks || !pendingAcks.empty(); });
+        if (pendingAcks.empty())
+            return;
+        acks.swap(pendingAcks);
+        lock.unlock();
+        for (auto [digestId, listId] : acks)
+            ackDigestList(digestId, listId);
+        acks.clear();
+        lock.lock();
+    }
+}
+
+/// \brief Probe the switch periodically until the connection is destroyed.
+/// \details If the switch does not answer in time, the stream is cancelled, so the thread reading
+/// it notices the dead peer and reconnects. Error responses prove the switch is alive.
+void SwitchConnection::probeLiveness()
+{
+    using PipelineConfigRequest = p4::v1::GetForwardingPipelineConfigRequest;
+
+    PipelineConfigRequest request;
+    request.set_device_id(deviceId);
+    request.set_response_type(PipelineConfigRequest::COOKIE_ONLY);
+    p4::v1::GetForwardingPipelineConfigResponse response;
+
+    unsigned failures = 0;
+    std::unique_lock<std::mutex> lock(keepaliveMutex);
+    while (!keepaliveCond.wait_for(lock, reconnectConfig.keepaliveInterval,
+        [this] { return stopKeepalive; }))
+    {
+        lock.unlock();
+        grpc::ClientContext ctx;
+        ctx.set_deadline(std::chrono::system_clock::now() + reconnectConfig.keepaliveTimeout);
+        auto status = stub->GetForwardingPipelineConfig(&ctx, request, &response);
+        bool failed = status.error_code() == grpc::StatusCode::DEADLINE_EXCEEDED
+            || status.error_code() == grpc::StatusCode::UNAVAILABLE;
+        failures = failed ? failures + 1 : 0;
+        if (failures >= reconnectConfig.keepaliveFailures)
+        {
+            failures = 0;
+            std::lock_guard<std::mutex> streamLock(streamWriteMutex);
+            if (stream)
+            {
+                std::cout << "Switch did not answer " << reconnectConfig.keepaliveFailures
+                    << " liveness probes: " << status.error_message() << std::endl;
+                streamClientCtx->TryCancel();
+            }
+        }
+        lock.lock();
+    }
 }
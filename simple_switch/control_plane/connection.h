@@ -7,9 +7,20 @@
 #include <grpc/grpc.h>
 #include <grpcpp/channel.h>
 #include <grpcpp/client_context.h>
+#include <grpcpp/completion_queue.h>
 
 #include "common.h"
 
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <span>
+#include <thread>
+#include <utility>
+#include <vector>
+
 
 /// \brief Encapsulated a write request for the dataplane. Constructed by
 /// SwitchConnection::createWriteRequest.
@@ -30,15 +41,91 @@ private:
 };
 
 
+/// \brief Limits of the asynchronous write path of SwitchConnection.
+struct WriteConfig
+{
+    /// Maximum number of Write RPCs in flight. Further writes block until one of them completes.
+    size_t maxInFlight = 16;
+    /// Maximum size of a serialized write request in bytes. Larger requests are split. gRPC
+    /// rejects messages larger than 4 MiB by default.
+    size_t maxRequestBytes = 1 << 20;
+};
+
+
+/// \brief Dead-peer detection and reconnection of the stream channel of SwitchConnection.
+/// \details The switch is probed with a GetForwardingPipelineConfig RPC requesting only the cookie
+/// instead of HTTP/2 keepalive pings, since gRPC servers with default settings (like bmv2) close
+/// connections sending pings more often than every five minutes.
+struct ReconnectConfig
+{
+    /// Reconnect if the stream breaks. If false, the control plane stops instead.
+    bool enabled = true;
+    /// Interval of liveness probes. Zero disables probing, then only broken connections noticed by
+    /// gRPC are detected.
+    std::chrono::milliseconds keepaliveInterval{200};
+    /// A probe fails if the switch does not answer it within this time.
+    std::chrono::milliseconds keepaliveTimeout{1000};
+    /// The switch is considered dead after this many consecutive failed probes. A single slow
+    /// answer, e.g., while the switch processes a large write request, does not break the stream.
+    unsigned keepaliveFailures = 3;
+    /// Time waited for the switch after the first failed attempt to reconnect. Doubles with every
+    /// failed attempt.
+    std::chrono::milliseconds minBackoff{20};
+    /// Maximum time waited for the switch between two attempts to reconnect.
+    std::chrono::milliseconds maxBackoff{500};
+};
+
+
+/// \brief Destination of a counter read by SwitchConnection::readCounters.
+/// \details The count of cell i is stored at index i of the arrays. Cells beyond the end of the
+/// arrays are ignored, cells the switch does not return keep their previous value.
+struct CounterReadout
+{
+    uint32_t counterId = 0;
+    /// Byte count of each cell. May be empty.
+    std::span<uint64_t> bytes;
+    /// Packet count of each cell. May be empty.
+    std::span<uint64_t> packets;
+};
+
+/// \brief Destination of a register read by SwitchConnection::readRegisters.
+/// \details Same layout as CounterReadout. Registers wider than 64 bits are truncated.
+struct RegisterReadout
+{
+    uint32_t registerId = 0;
+    std::span<uint64_t> values;
+};
+
+
 /// \brief P4Runtime connection to a switch.
 class SwitchConnection
 {
 public:
+    /// \brief Invoked with the result of an asynchronous write request.
+    using WriteCallback = std::function<void(bool success)>;
+    /// \brief Invoked for every entity returned by a read request.
+    using ReadVisitor = std::function<void(const p4::v1::Entity& entity)>;
+
     /// \brief Connects to the switch and opens the persistent stream channel.
     /// \param[in] address Address and port of the switch's gRPC server.
     /// \param[in] deviceId Identifies a forwarding device to control within the switch.
     /// \param[in] electionId Election ID of the controller. Higher IDs win.
-    SwitchConnection(const grpc::string& address, DeviceId deviceId, ElectionId electionId);
+    /// \param[in] writeConfig Limits of asynchronous write requests.
+    /// \param[in] reconnectConfig Liveness probes and reconnection backoff.
+    SwitchConnection(const grpc::string& address, DeviceId deviceId, ElectionId electionId,
+        const WriteConfig& writeConfig = WriteConfig(),
+        const ReconnectConfig& reconnectConfig = ReconnectConfig());
+    /// \brief Waits for all asynchronous write requests to complete.
+    ~SwitchConnection();
+
+    const ReconnectConfig& getReconnectConfig() const { return reconnectConfig; }
+
+    /// \brief Replace a broken stream channel by a new one.
+    /// \details Must be called from the thread reading the stream after readStream() failed. The
+    /// master arbitration update has to be sent again on the new stream.
+    /// \param[in] timeout Maximum time to wait for the switch to become reachable.
+    /// \return True if a new stream has been opened, false if the switch is not reachable.
+    bool reopenStream(std::chrono::milliseconds timeout);
 
     /// \brief Send a master arbitration update to the switch to announce the  controller's
     /// presence. Must be called before anything else.
@@ -46,8 +133,20 @@ public:
     bool sendMasterArbitrationUpdate();
 
     /// \brief Apply a new pipeline configuration to the switch.
+    /// \param[in] cookie Identifies the pipeline, zero for none. See getPipelineCookie().
+    /// \param[in] action VERIFY_AND_COMMIT replaces the pipeline and clears all forwarding state,
+    /// RECONCILE_AND_COMMIT keeps state that is still valid if the switch supports it.
     /// \return True on success, false on failure.
-    bool setPipelineConfig(const p4::config::v1::P4Info& p4Info, const DeviceConfig& deviceConfig);
+    bool setPipelineConfig(const p4::config::v1::P4Info& p4Info, const DeviceConfig& deviceConfig,
+        uint64_t cookie = 0,
+        p4::v1::SetForwardingPipelineConfigRequest::Action action =
+            p4::v1::SetForwardingPipelineConfigRequest::VERIFY_AND_COMMIT);
+
+    /// \brief Retrieve the cookie of the pipeline the switch is running.
+    /// \details Only the cookie is requested, not the full P4Info and device configuration.
+    /// \param[out] cookie Cookie set with the pipeline or zero if the pipeline has none.
+    /// \return True on success, false if the switch has no pipeline or the request failed.
+    bool getPipelineCookie(uint64_t& cookie);
 
     /// \brief Return an empty WriteRequest to be populated with updates by the caller.
     WriteRequest createWriteRequest() const
@@ -56,9 +155,48 @@ public:
     }
 
     /// \brief Send a write request to the switch.
+    /// \details Blocks until the switch responds. Asynchronous writes sent before may still be in
+    /// flight.
     /// \return True on success, false on failure.
     bool sendWriteRequest(const WriteRequest &request);
 
+    /// \brief Send a write request to the switch without waiting for the response.
+    /// \details Requests larger than WriteConfig::maxRequestBytes are split into multiple Write
+    /// RPCs. Blocks while WriteConfig::maxInFlight RPCs are in flight. The switch may apply
+    /// requests in flight at the same time in any order, writes depending on each other must wait
+    /// for the result of the earlier write.
+    /// \param[in] request Updates to write.
+    /// \param[in] callback Invoked once all parts of the request completed. Runs on the thread
+    /// completing the RPCs, so it must neither block nor send write requests itself.
+    /// \return Future becoming true if all updates succeeded, false otherwise.
+    std::future<bool> sendWriteRequestAsync(WriteRequest request, WriteCallback callback = nullptr);
+
+    /// \brief Block until all asynchronous write requests completed.
+    void waitForWrites();
+
+    /// \brief Read entities from the switch.
+    /// \param[in] entity Entity to read. Fields that are not set act as wildcards, e.g., a counter
+    /// entry without an index reads all cells of the counter.
+    /// \param[out] entities Entities returned by the switch are appended to this vector.
+    /// \return True on success, false on failure.
+    bool sendReadRequest(const p4::v1::Entity& entity, std::vector<p4::v1::Entity>& entities);
+
+    /// \brief Read many entities with a single request.
+    /// \details The response stream is processed message by message, entities are handed to the
+    /// visitor as they arrive instead of being collected.
+    /// \param[in] entities Entities to read, may contain wildcards.
+    /// \param[in] visitor Invoked for every entity returned by the switch.
+    /// \return True on success, false on failure.
+    bool sendReadRequest(std::span<const p4::v1::Entity> entities, const ReadVisitor& visitor);
+
+    /// \brief Read all cells of the given counters with a single request.
+    /// \return True on success, false on failure.
+    bool readCounters(std::span<const CounterReadout> counters);
+
+    /// \brief Read all cells of the given registers with a single request.
+    /// \return True on success, false on failure.
+    bool readRegisters(std::span<const RegisterReadout> registers);
+
     /// \brief Read the next message from the persistent stream.
     bool readStream(p4::v1::StreamMessageResponse& response)
     {
@@ -71,13 +209,52 @@ public:
     /// \return True on success, false on failure.
     bool ackDigestList(uint32_t digestId, uint64_t listId);
 
+    /// \brief Acknowledge a digest list without blocking.
+    /// \details The acknowledgement is sent by a background thread. Unlike ackDigestList(), this
+    /// may be called from write callbacks.
+    void queueDigestAck(uint32_t digestId, uint64_t listId);
+
+private:
+    struct WriteBatch;
+    struct PendingWrite;
+
+    std::vector<std::unique_ptr<p4::v1::WriteRequest>> splitWriteRequest(
+        std::unique_ptr<p4::v1::WriteRequest> request) const;
+    void completeWrites();
+    void probeLiveness();
+    void sendDigestAcks();
+
 private:
     const DeviceId deviceId;
     const ElectionId electionId;
+    const WriteConfig writeConfig;
+    const ReconnectConfig reconnectConfig;
     std::shared_ptr<grpc::Channel> channel;
     std::unique_ptr<grpc::ClientContext> streamClientCtx;
     std::unique_ptr<p4::v1::P4Runtime::Stub> stub;
     std::unique_ptr<grpc::ClientReaderWriterInterface<
         p4::v1::StreamMessageRequest, p4::v1::StreamMessageResponse>>
         stream;
+    std::mutex streamWriteMutex; // Digest acks may be sent from the write completion thread
+                                 // Also guards replacing the stream
+
+    // Asynchronous writes
+    grpc::CompletionQueue writeQueue;
+    std::thread writeThread;
+    std::mutex writeMutex;
+    std::condition_variable writeCond;
+    size_t writesInFlight = 0;
+
+    // Digest acknowledgements queued by queueDigestAck()
+    std::thread ackThread;
+    std::mutex ackMutex;
+    std::condition_variable ackCond;
+    std::vector<std::pair<uint32_t, uint64_t>> pendingAcks; // digest ID and list ID
+    bool stopAcks = false;
+
+    // Liveness probes
+    std::thread keepaliveThread;
+    std::mutex keepaliveMutex;
+    std::condition_variable keepaliveCond;
+    bool stopKeepalive = false;
 };
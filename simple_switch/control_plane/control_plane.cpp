@@ -1,5 +1,7 @@
 #include "control_plane.h"
 #include "bitstring.h"
+#include "p4_util.h"
+#include "ring_buffer.h"
 
 #include <p4/v1/p4data.pb.h>
 #include <p4/v1/p4runtime.pb.h>
@@ -7,10 +9,13 @@
 #include <p4/config/v1/p4info.pb.h>
 #include <boost/range/adaptor/reversed.hpp>
 
+#include <algorithm>
+#include <chrono>
 #include <iomanip>
 #include <iostream>
 #include <stdexcept>
 #include <string>
+#include <thread>
 
 using p4::config::v1::P4Info;
 
@@ -22,53 +27,248 @@ ControlPlane::ControlPlane(
     : con(std::move(connection))
     , p4Info(std::move(p4Info))
     , deviceConfig(std::move(config))
+    , cookie(pipelineCookie(*this->p4Info, deviceConfig))
+    , backoff(con->getReconnectConfig().minBackoff)
 {
     ctrls.reserve(nCtrls);
 }
 
+void ControlPlane::setPipeline(size_t workers, size_t queueDepth, PacketInHash hash)
+{
+    if (workers > 0 && queueDepth == 0)
+        throw std::invalid_argument("Queue depth of the pipeline must be at least 1");
+    if (workers > 0 && queueDepth > MAX_PIPELINE_MESSAGES / (workers + 1))
+        throw std::invalid_argument("Pipeline exceeds " + std::to_string(MAX_PIPELINE_MESSAGES)
+            + " messages, reduce the number of workers or the queue depth");
+    pipelineWorkers = workers;
+    pipelineQueueDepth = queueDepth;
+    packetInHash = std::move(hash);
+}
+
 void ControlPlane::run()
 {
     using p4::v1::StreamMessageResponse;
-    using boost::adaptors::reverse;
 
     if (!con->sendMasterArbitrationUpdate())
         return;
 
+    if (pipelineWorkers > 0)
+    {
+        runPipelined();
+        return;
+    }
+
     StreamMessageResponse msg;
-    while(con->readStream(msg))
+    while(readStream(msg))
+        dispatch(msg);
+}
+
+ControlPlane::StreamStats ControlPlane::getStreamStats() const
+{
+    std::lock_guard<std::mutex> lock(statsMutex);
+    return streamStats;
+}
+
+/// \brief Read the next message from the stream, reconnecting if the stream is broken.
+/// \details When the stream breaks, an arbitration update with status UNAVAILABLE is returned
+/// first, so the subcontrollers learn that they are no longer primary in order with the other
+/// events. The connection is restored on the next call.
+/// \return False if the stream is broken and reconnecting is disabled.
+bool ControlPlane::readStream(p4::v1::StreamMessageResponse& msg)
+{
+    if (streamLost)
+    {
+        streamLost = false;
+        if (!reconnect())
+            return false;
+    }
+    if (!con->readStream(msg))
     {
-        switch (msg.update_case())
+        if (!con->getReconnectConfig().enabled)
+            return false;
         {
-        case StreamMessageResponse::kArbitration:
-            handleArbitrationUpdate(msg.arbitration());
-            for (const auto &ctrl : ctrls)
-                ctrl->handleArbitrationUpdate(*con, msg.arbitration());
-            break;
-        case StreamMessageResponse::kPacket:
-            for (const auto &ctrl : reverse(ctrls))
-                if (ctrl->handlePacketIn(*con, msg.packet()))
-                    break;
-            break;
-        case StreamMessageResponse::kDigest:
-            for (const auto &ctrl : reverse(ctrls))
-                if (ctrl->handleDigest(*con, msg.digest()))
-                    break;
-            break;
-        case StreamMessageResponse::kIdleTimeoutNotification:
-            for (const auto &ctrl : reverse(ctrls))
-                if (ctrl->handleIdleTimeout(*con, msg.idle_timeout_notification()))
-                    break;
-            break;
-        case StreamMessageResponse::kError:
-            for (const auto &ctrl : reverse(ctrls))
-                if (ctrl->handleError(*con, msg.error()))
-                    break;
-            break;
-        default:
-            std::cout << "Unknown data plane event" << std::endl;
+            std::lock_guard<std::mutex> lock(statsMutex);
+            if (!outageStart)
+                outageStart = std::chrono::steady_clock::now();
+        }
+        msg.Clear();
+        auto status = msg.mutable_arbitration()->mutable_status();
+        status->set_code(static_cast<int>(grpc::StatusCode::UNAVAILABLE));
+        status->set_message("Lost stream to switch");
+        streamLost = true;
+        return true;
+    }
+    if (msg.has_arbitration())
+        backoff = con->getReconnectConfig().minBackoff;
+    return true;
+}
+
+/// \brief Open a new stream and send an arbitration update on it.
+/// \details Retries with exponential backoff until the switch is reachable again. The backoff is
+/// only reset once the switch answers the arbitration update, so a switch that accepts connections
+/// but closes the stream right away is not hammered.
+/// \return False if reconnecting is disabled.
+bool ControlPlane::reconnect()
+{
+    using namespace std::chrono;
+    const auto& config = con->getReconnectConfig();
+    if (!config.enabled)
+        return false;
+
+    std::cout << "Reconnecting to switch" << std::endl;
+    {
+        std::lock_guard<std::mutex> lock(statsMutex);
+        if (!outageStart)
+            outageStart = steady_clock::now();
+    }
+
+    while (true)
+    {
+        auto attemptStart = steady_clock::now();
+        auto timeout = backoff;
+        backoff = std::min(2 * backoff, config.maxBackoff);
+        if (con->reopenStream(timeout) && con->sendMasterArbitrationUpdate())
+            return true;
+        std::this_thread::sleep_until(attemptStart + timeout);
+    }
+}
+
+/// \brief Update the outage statistics after the arbitration response has been handled.
+/// \param[in] received Time the arbitration response was dispatched.
+void ControlPlane::recordResync(std::chrono::steady_clock::time_point received)
+{
+    using namespace std::chrono;
+
+    std::lock_guard<std::mutex> lock(statsMutex);
+    if (!outageStart)
+        return;
+    auto outage = duration_cast<microseconds>(received - *outageStart);
+    auto resync = duration_cast<microseconds>(steady_clock::now() - received);
+    outageStart.reset();
+
+    ++streamStats.reconnects;
+    streamStats.lastOutage = outage;
+    streamStats.maxOutage = std::max(streamStats.maxOutage, outage);
+    streamStats.lastResync = resync;
+    streamStats.maxResync = std::max(streamStats.maxResync, resync);
+    std::cout << std::dec << "Stream restored after " << outage.count() / 1000 << " ms, "
+        << "resynchronized in " << resync.count() / 1000 << " ms ("
+        << streamStats.reconnects << " reconnects)" << std::endl;
+}
+
+/// \brief Read the stream on the calling thread and distribute the messages to the workers.
+/// \details Message objects are allocated once and recycled through a free list, so no memory is
+/// allocated per message once the pipeline is warmed up. The reader blocks if all message objects
+/// are in use, which propagates back pressure to the switch.
+void ControlPlane::runPipelined()
+{
+    using p4::v1::StreamMessageResponse;
+    using MessagePtr = StreamMessageResponse*;
+
+    const size_t nWorkers = pipelineWorkers;
+    const size_t poolSize = (nWorkers + 1) * pipelineQueueDepth;
+    std::vector<std::unique_ptr<StreamMessageResponse>> messages;
+    MpmcRing<MessagePtr> freeList(poolSize);
+    messages.reserve(poolSize);
+    for (size_t i = 0; i < poolSize; ++i)
+    {
+        messages.push_back(std::make_unique<StreamMessageResponse>());
+        freeList.tryPush(messages.back().get());
+    }
+
+    // One lane per worker plus the control lane. A null pointer terminates the lane.
+    std::vector<std::unique_ptr<SpscRing<MessagePtr>>> lanes;
+    for (size_t i = 0; i < nWorkers + 1; ++i)
+        lanes.push_back(std::make_unique<SpscRing<MessagePtr>>(pipelineQueueDepth));
+    auto& controlLane = *lanes.back();
+
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < nWorkers; ++i)
+    {
+        threads.emplace_back([this, &lane = *lanes[i], &freeList] {
+            while (auto msg = lane.pop())
+            {
+                dispatchPacketIn(msg->packet());
+                freeList.tryPush(msg);
+            }
+        });
+    }
+    threads.emplace_back([this, &controlLane, &freeList] {
+        while (auto msg = controlLane.pop())
+        {
+            dispatch(*msg);
+            freeList.tryPush(msg);
+        }
+    });
+
+    while (true)
+    {
+        auto msg = freeList.pop();
+        if (!readStream(*msg))
             break;
+        if (msg->update_case() == StreamMessageResponse::kPacket)
+        {
+            size_t hash = packetInHash ? packetInHash(msg->packet()) : 0;
+            lanes[hash % nWorkers]->push(msg);
         }
+        else
+            controlLane.push(msg);
     }
+
+    for (auto& lane : lanes)
+        lane->push(nullptr);
+    for (auto& thread : threads)
+        thread.join();
+}
+
+void ControlPlane::dispatch(const p4::v1::StreamMessageResponse& msg)
+{
+    using p4::v1::StreamMessageResponse;
+    using boost::adaptors::reverse;
+
+    switch (msg.update_case())
+    {
+    case StreamMessageResponse::kArbitration:
+    {
+        auto received = std::chrono::steady_clock::now();
+        handleArbitrationUpdate(msg.arbitration());
+        for (const auto &ctrl : ctrls)
+            ctrl->handleArbitrationUpdate(*con, msg.arbitration());
+        if (msg.arbitration().status().code() != static_cast<int>(grpc::StatusCode::UNAVAILABLE))
+            recordResync(received);
+        break;
+    }
+    case StreamMessageResponse::kPacket:
+        dispatchPacketIn(msg.packet());
+        break;
+    case StreamMessageResponse::kDigest:
+        for (const auto &ctrl : reverse(ctrls))
+            if (ctrl->handleDigest(*con, msg.digest()))
+                break;
+        break;
+    case StreamMessageResponse::kIdleTimeoutNotification:
+        for (const auto &ctrl : reverse(ctrls))
+            if (ctrl->handleIdleTimeout(*con, msg.idle_timeout_notification()))
+                break;
+        break;
+    case StreamMessageResponse::kError:
+        for (const auto &ctrl : reverse(ctrls))
+            if (ctrl->handleError(*con, msg.error()))
+                break;
+        break;
+    default:
+        std::cout << "Unknown data plane event" << std::endl;
+        break;
+    }
+}
+
+void ControlPlane::dispatchPacketIn(const p4::v1::PacketIn& packetIn)
+{
+    using boost::adaptors::reverse;
+
+    for (const auto &ctrl : reverse(ctrls))
+        if (ctrl->handlePacketIn(*con, packetIn))
+            break;
 }
 
 void ControlPlane::handleArbitrationUpdate(const p4::v1::MasterArbitrationUpdate& arbUpdate)
@@ -76,10 +276,38 @@ void ControlPlane::handleArbitrationUpdate(const p4::v1::MasterArbitrationUpdate
     if (!arbUpdate.status().code())
     {
         std::cout << "Elected as primary controller" << std::endl;
-        con->setPipelineConfig(*p4Info.get(), deviceConfig);
+        configurePipeline();
+    }
+    else if (arbUpdate.status().code() == static_cast<int>(grpc::StatusCode::UNAVAILABLE))
+    {
+        std::cout << arbUpdate.status().message() << std::endl;
     }
     else
     {
         std::cout << "Other controller elected as primary" << std::endl;
     }
 }
+
+/// \brief Make sure the switch runs the pipeline of this controller.
+/// \details Replacing the pipeline clears all tables, so the pipeline is only pushed if the cookie
+/// reported by the switch differs. A switch that already runs a pipeline is first asked to
+/// reconcile its state with the new one. Switches not supporting that (e.g., bmv2) fall back to
+/// replacing the pipeline.
+void ControlPlane::configurePipeline()
+{
+    using p4::v1::SetForwardingPipelineConfigRequest;
+
+    uint64_t current = 0;
+    bool hasPipeline = con->getPipelineCookie(current);
+    if (hasPipeline && current == cookie)
+    {
+        std::cout << "Pipeline 0x" << std::hex << cookie << " already configured" << std::endl;
+        return;
+    }
+
+    std::cout << "Pushing pipeline 0x" << std::hex << cookie << std::endl;
+    if (hasPipeline && con->setPipelineConfig(*p4Info, deviceConfig, cookie,
+        SetForwardingPipelineConfigRequest::RECONCILE_AND_COMMIT))
+        return;
+    con->setPipelineConfig(*p4Info, deviceConfig, cookie);
+}
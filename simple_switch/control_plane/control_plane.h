@@ -8,7 +8,11 @@
 #include <p4/v1/p4runtime.grpc.pb.h>
 #include <p4/config/v1/p4info.pb.h>
 
+#include <chrono>
+#include <functional>
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <utility>
 #include <vector>
 
@@ -23,10 +27,43 @@
 ///
 /// The handleArbitrationUpdate() callback is processed in reverse order (from bottom to top of the
 /// stack), since it is used to perform data plane initialization when this controller is elected as
-/// primary.
+/// primary. The pipeline is only pushed to the switch if it does not run it already, so forwarding
+/// state survives a restart of the controller.
+///
+/// By default all events are handled on the thread calling run(). If a pipeline has been
+/// configured with setPipeline(), a dedicated thread reads the stream and hands packet-in messages
+/// to a pool of worker threads over bounded ring buffers. All other events are processed in order
+/// on a separate control thread.
+///
+/// If the stream to the switch breaks, the subcontrollers receive an arbitration update with status
+/// UNAVAILABLE, since the controller is no longer primary. The control plane then reconnects with
+/// exponential backoff as configured in the ReconnectConfig of the connection and sends a new
+/// arbitration update. The subcontrollers stay in place and resynchronize the data plane in
+/// handleArbitrationUpdate().
 class ControlPlane
 {
 public:
+    /// \brief Maps packet-in messages to a flow hash. Messages with the same hash are always
+    /// processed by the same worker in the order they were received.
+    using PacketInHash = std::function<size_t(const p4::v1::PacketIn&)>;
+
+    /// \brief Maximum number of messages in the pipeline, (workers + 1) * queue depth. The free list
+    /// of messages is a fixed-size lock-free queue, which cannot hold more than 65535 elements.
+    static constexpr size_t MAX_PIPELINE_MESSAGES = 65535;
+
+    /// \brief Statistics of interruptions of the stream to the switch.
+    struct StreamStats
+    {
+        /// Number of times the stream has been restored.
+        size_t reconnects = 0;
+        /// Time from losing the stream to the arbitration response on the new stream.
+        std::chrono::microseconds lastOutage{0};
+        std::chrono::microseconds maxOutage{0};
+        /// Time the subcontrollers took to resynchronize the data plane after the last outage.
+        std::chrono::microseconds lastResync{0};
+        std::chrono::microseconds maxResync{0};
+    };
+
     /// \brief Create a controller with the give P4Info and device configuration.
     /// \param[in] connection SwitchConnection object already connected to the switch.
     /// \param[in] p4Info Switch API definition.
@@ -45,15 +82,45 @@ public:
         ctrls.emplace_back(std::make_unique<T>(*con, *p4Info, std::forward<Args>(args)...));
     }
 
-    /// \brief Run the controller. Returns when the connection has been closed by the switch.
+    /// \brief Process packet-in messages on multiple worker threads.
+    /// \param[in] workers Number of worker threads. Zero handles all events on the calling thread.
+    /// \param[in] queueDepth Capacity of the ring buffer of each worker.
+    /// \param[in] hash Flow hash used to assign packets to workers.
+    /// \exception std::invalid_argument The queue depth is zero or the pipeline would hold more
+    /// than MAX_PIPELINE_MESSAGES messages.
+    void setPipeline(size_t workers, size_t queueDepth, PacketInHash hash);
+
+    /// \brief Run the controller. Returns when the connection has been closed by the switch and
+    /// reconnecting is disabled.
     void run();
 
+    /// \brief Statistics of stream outages. Safe to call from any thread.
+    StreamStats getStreamStats() const;
+
 private:
+    void runPipelined();
+    bool readStream(p4::v1::StreamMessageResponse& msg);
+    bool reconnect();
+    void recordResync(std::chrono::steady_clock::time_point received);
+    void dispatch(const p4::v1::StreamMessageResponse& msg);
+    void dispatchPacketIn(const p4::v1::PacketIn& packetIn);
     void handleArbitrationUpdate(const p4::v1::MasterArbitrationUpdate& arbUpdate);
+    void configurePipeline();
 
 private:
     std::unique_ptr<SwitchConnection> con;
     std::unique_ptr<p4::config::v1::P4Info> p4Info;
     DeviceConfig deviceConfig;
+    uint64_t cookie; // identifies p4Info and deviceConfig
     std::vector<std::unique_ptr<Controller>> ctrls;
+    size_t pipelineWorkers = 0;
+    size_t pipelineQueueDepth = 0;
+    PacketInHash packetInHash;
+
+    // Reconnection, the backoff is only accessed by the thread reading the stream
+    std::chrono::milliseconds backoff;
+    bool streamLost = false;
+    mutable std::mutex statsMutex;
+    std::optional<std::chrono::steady_clock::time_point> outageStart;
+    StreamStats streamStats;
 };
@@ -31,6 +31,9 @@ public:
     {};
 
     /// \brief Handle packet-in message.
+    /// \details If the control plane runs a packet-in pipeline, this callback is invoked
+    /// concurrently from multiple worker threads. Packets belonging to the same flow are always
+    /// handled by the same thread in the order they were received.
     /// \return Returning true indicates that the event has been handled and no more processing is
     /// required by other controllers. If false is returned, the event will continue to travel down
     /// the stack of controllers.
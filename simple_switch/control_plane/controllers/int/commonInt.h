@@ -23,3 +23,23 @@ using nodeID_t = uint32_t;
 
 constexpr size_t LINK_UTIL_BYTES = 4;
 using LinkUtil = uint32_t;
+
+constexpr size_t MTU_BYTES = 2;
+using Mtu = uint16_t;
+
+/// \brief Selection of the packets the INT source adds INT to. Values of the sampleMode parameter
+/// of insert_int.
+enum class IntSampleMode : uint8_t
+{
+    All = 0,    ///< Every packet
+    Flow = 1,   ///< All packets of 1 in N flows, selected by a hash of the flow
+    Random = 2, ///< 1 in N packets at random
+    First = 3,  ///< The first N packets of every flow
+};
+
+/// \brief Sampling of the INT source for a destination.
+struct IntSampling
+{
+    IntSampleMode mode = IntSampleMode::All;
+    uint16_t rate = 1;
+};
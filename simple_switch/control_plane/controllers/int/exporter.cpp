@@ -0,0 +1,394 @@
+#include "exporter.h"
+#include "addressConversion.h"
+#include "takeUint.h"
+
+#include <boost/asio.hpp>
+
+#include <algorithm>
+#include <cstdio>
+#include <iostream>
+#include <stdexcept>
+
+
+namespace {
+
+/// \brief Exports reports to Kafka. librdkafka queues and batches the reports itself.
+class KafkaExporter : public Exporter
+{
+public:
+    KafkaExporter(const KafkaConfig& config)
+        : sinkName("kafka=" + config.brokers)
+        , producer(config)
+    {}
+
+    const std::string& name() const override { return sinkName; }
+
+    bool submit(const ExportRecordPtr& record) override
+    {
+        return producer.send(*record->topic, record->flowHash, record->key, record->report);
+    }
+
+    void prepareTopic(const ReportTopic& topic) override { producer.prepareTopic(topic); }
+
+    void close() override { producer.close(); }
+
+    ExporterStats getStats() const override
+    {
+        auto kafkaStats = producer.getStats();
+        ExporterStats stats;
+        stats.exported = kafkaStats.delivered;
+        stats.droppedQueueFull = kafkaStats.droppedQueueFull;
+        stats.droppedError = kafkaStats.droppedError + kafkaStats.failed;
+        return stats;
+    }
+
+private:
+    const std::string sinkName;
+    kafkaProducer producer;
+};
+
+/// \brief Exports length-prefixed reports over TCP. The client has its own queue and I/O thread.
+class TcpExporter : public Exporter
+{
+public:
+    TcpExporter(std::string address, const TcpConfig& config)
+        : sinkName("tcp=" + address)
+        , client(config)
+    {
+        std::string ipAddr;
+        uint16_t port = 0;
+        splitIpAddress(address, ipAddr, port);
+        client.createClient(tcp::endpoint(boost::asio::ip::make_address(ipAddr), port));
+    }
+
+    const std::string& name() const override { return sinkName; }
+
+    bool submit(const ExportRecordPtr& record) override
+    {
+        return client.send(record->report);
+    }
+
+    void close() override { client.close(); }
+
+    ExporterStats getStats() const override
+    {
+        auto tcpStats = client.getStats();
+        ExporterStats stats;
+        stats.exported = tcpStats.sent;
+        stats.droppedQueueFull = tcpStats.droppedQueueFull;
+        stats.droppedError = tcpStats.droppedError;
+        return stats;
+    }
+
+private:
+    const std::string sinkName;
+    tcpClient client;
+};
+
+/// \brief Exports every report as a single UDP datagram.
+class UdpExporter : public QueuedExporter
+{
+public:
+    UdpExporter(std::string address, const TcpConfig& config)
+        : QueuedExporter("udp=" + address, config.maxQueuedBytes, MAX_BATCH)
+        , socket(ioContext)
+    {
+        std::string ipAddr;
+        uint16_t port = 0;
+        splitIpAddress(address, ipAddr, port);
+        endpoint = boost::asio::ip::udp::endpoint(boost::asio::ip::make_address(ipAddr), port);
+        socket.open(endpoint.protocol());
+        start();
+    }
+
+    ~UdpExporter() { close(); }
+
+protected:
+    size_t writeBatch(const std::vector<ExportRecordPtr>& batch) override
+    {
+        size_t failed = 0;
+        for (const auto& record : batch)
+        {
+            boost::system::error_code err;
+            socket.send_to(boost::asio::buffer(record->report), endpoint, 0, err);
+            if (err)
+                ++failed;
+        }
+        return failed;
+    }
+
+private:
+    static constexpr size_t MAX_BATCH = 64;
+    boost::asio::io_context ioContext;
+    boost::asio::ip::udp::socket socket;
+    boost::asio::ip::udp::endpoint endpoint;
+};
+
+/// \brief Exports length-prefixed reports over a Unix domain stream socket.
+class UnixExporter : public QueuedExporter
+{
+public:
+    UnixExporter(std::string path, const TcpConfig& config)
+        : QueuedExporter("unix=" + path, config.maxQueuedBytes, MAX_BATCH)
+        , config(config)
+        , endpoint(path)
+        , socket(ioContext)
+        , backoff(config.minBackoff)
+    {
+        start();
+    }
+
+    ~UnixExporter() { close(); }
+
+protected:
+    size_t writeBatch(const std::vector<ExportRecordPtr>& batch) override
+    {
+        boost::system::error_code err;
+        if (!socket.is_open())
+        {
+            socket.connect(endpoint, err);
+            if (err)
+            {
+                // Reports are dropped while the peer is unreachable
+                socket.close();
+                std::cout << "Error: Could not connect to " << name() << ": " << err.message()
+                    << std::endl;
+                waitFor(backoff);
+                backoff = std::min(2 * backoff, config.maxBackoff);
+                return batch.size();
+            }
+            backoff = config.minBackoff;
+        }
+
+        frameBatch(batch, headers, buffers);
+        boost::asio::write(socket, buffers, err);
+        if (err)
+        {
+            std::cout << "Error: Writing to " << name() << " failed: " << err.message() << std::endl;
+            socket.close();
+            return batch.size();
+        }
+        return 0;
+    }
+
+private:
+    static constexpr size_t MAX_BATCH = 256;
+    const TcpConfig config;
+    boost::asio::io_context ioContext;
+    boost::asio::local::stream_protocol::endpoint endpoint;
+    boost::asio::local::stream_protocol::socket socket;
+    std::chrono::milliseconds backoff;
+    std::vector<uint32_t> headers;
+    std::vector<boost::asio::const_buffer> buffers;
+};
+
+/// \brief Appends length-prefixed reports to a file.
+class FileExporter : public QueuedExporter
+{
+public:
+    FileExporter(std::string path, const TcpConfig& config)
+        : QueuedExporter("file=" + path, config.maxQueuedBytes, MAX_BATCH)
+        , file(std::fopen(path.c_str(), "ab"))
+    {
+        if (!file)
+            throw std::runtime_error("Cannot open " + path);
+        start();
+    }
+
+    ~FileExporter()
+    {
+        close();
+        std::fclose(file);
+    }
+
+protected:
+    size_t writeBatch(const std::vector<ExportRecordPtr>& batch) override
+    {
+        frameBatch(batch, headers, buffers);
+        bool ok = true;
+        for (const auto& buffer : buffers)
+            ok &= std::fwrite(buffer.data(), 1, buffer.size(), file) == buffer.size();
+        ok &= std::fflush(file) == 0;
+        return ok ? 0 : batch.size();
+    }
+
+private:
+    static constexpr size_t MAX_BATCH = 256;
+    std::FILE* file;
+    std::vector<uint32_t> headers;
+    std::vector<boost::asio::const_buffer> buffers;
+};
+
+} // namespace
+
+
+SinkConfig parseSinkConfig(const std::string& str)
+{
+    auto pos = str.find('=');
+    if (pos == std::string::npos || pos == 0 || pos + 1 == str.size())
+        throw std::invalid_argument("Invalid sink \"" + str + "\", expected <type>=<address>");
+    return SinkConfig{str.substr(0, pos), str.substr(pos + 1)};
+}
+
+std::unique_ptr<Exporter> makeExporter(
+    const SinkConfig& sink, const KafkaConfig& kafkaConfig, const TcpConfig& tcpConfig)
+{
+    if (sink.type == "kafka")
+    {
+        KafkaConfig config = kafkaConfig;
+        config.brokers = sink.address;
+        return std::make_unique<KafkaExporter>(config);
+    }
+    if (sink.type == "tcp")
+        return std::make_unique<TcpExporter>(sink.address, tcpConfig);
+    if (sink.type == "udp")
+        return std::make_unique<UdpExporter>(sink.address, tcpConfig);
+    if (sink.type == "unix")
+        return std::make_unique<UnixExporter>(sink.address, tcpConfig);
+    if (sink.type == "file")
+        return std::make_unique<FileExporter>(sink.address, tcpConfig);
+    throw std::invalid_argument("Unknown sink type \"" + sink.type + "\"");
+}
+
+////////////////////
+// ExporterFanOut //
+////////////////////
+
+ExporterFanOut::~ExporterFanOut()
+{
+    for (auto& exporter : exporters)
+        exporter->close();
+    printStats();
+}
+
+void ExporterFanOut::addExporter(std::unique_ptr<Exporter> exporter)
+{
+    std::cout << "Exporting INT reports to " << exporter->name() << std::endl;
+    exporters.push_back(std::move(exporter));
+}
+
+void ExporterFanOut::publish(std::shared_ptr<const ReportTopic> topic, uint64_t flowHash,
+    std::string_view key, std::string_view report)
+{
+    if (exporters.empty())
+        return;
+
+    auto record = std::make_shared<const ExportRecord>(ExportRecord{
+        std::move(topic), flowHash, std::string(key), std::string(report)});
+    for (auto& exporter : exporters)
+        exporter->submit(record);
+}
+
+void ExporterFanOut::prepareTopic(const ReportTopic& topic)
+{
+    for (auto& exporter : exporters)
+        exporter->prepareTopic(topic);
+}
+
+void ExporterFanOut::printStats() const
+{
+    for (const auto& exporter : exporters)
+    {
+        auto stats = exporter->getStats();
+        std::cout << std::dec << exporter->name() << ": exported " << stats.exported
+            << ", dropped (queue full) " << stats.droppedQueueFull
+            << ", dropped (error) " << stats.droppedError << std::endl;
+    }
+}
+
+////////////////////
+// QueuedExporter //
+////////////////////
+
+QueuedExporter::QueuedExporter(std::string name, size_t maxQueuedBytes, size_t maxBatch)
+    : sinkName(std::move(name))
+    , maxQueuedBytes(maxQueuedBytes)
+    , maxBatch(maxBatch)
+{}
+
+void QueuedExporter::start()
+{
+    worker = std::thread(&QueuedExporter::run, this);
+}
+
+void QueuedExporter::close()
+{
+    {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        stopping = true;
+    }
+    queueCond.notify_all();
+    if (worker.joinable())
+        worker.join();
+}
+
+bool QueuedExporter::submit(const ExportRecordPtr& record)
+{
+    {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        if (stopping || queuedBytes + record->report.size() > maxQueuedBytes)
+        {
+            droppedQueueFull.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        queuedBytes += record->report.size();
+        queue.push_back(record);
+    }
+    queueCond.notify_one();
+    return true;
+}
+
+ExporterStats QueuedExporter::getStats() const
+{
+    ExporterStats stats;
+    stats.exported = exported.load(std::memory_order_relaxed);
+    stats.droppedQueueFull = droppedQueueFull.load(std::memory_order_relaxed);
+    stats.droppedError = droppedError.load(std::memory_order_relaxed);
+    return stats;
+}
+
+void QueuedExporter::frameBatch(const std::vector<ExportRecordPtr>& batch,
+    std::vector<uint32_t>& headers, std::vector<boost::asio::const_buffer>& buffers)
+{
+    headers.resize(batch.size());
+    buffers.clear();
+    for (size_t i = 0; i < batch.size(); ++i)
+    {
+        const auto& report = batch[i]->report;
+        storeBigEndian<uint32_t>(&headers[i], static_cast<uint32_t>(report.size()));
+        buffers.push_back(boost::asio::buffer(&headers[i], sizeof(uint32_t)));
+        buffers.push_back(boost::asio::buffer(report));
+    }
+}
+
+bool QueuedExporter::waitFor(std::chrono::milliseconds duration)
+{
+    std::unique_lock<std::mutex> lock(queueMutex);
+    return !queueCond.wait_for(lock, duration, [this] { return stopping; });
+}
+
+/// \brief Worker thread. Drains the queue before it exits.
+void QueuedExporter::run()
+{
+    std::vector<ExportRecordPtr> batch;
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(queueMutex);
+            queueCond.wait(lock, [this] { return stopping || !queue.empty(); });
+            if (queue.empty())
+                break;
+            while (!queue.empty() && batch.size() < maxBatch)
+            {
+                queuedBytes -= queue.front()->report.size();
+                batch.push_back(std::move(queue.front()));
+                queue.pop_front();
+            }
+        }
+
+        size_t failed = writeBatch(batch);
+        exported.fetch_add(batch.size() - failed, std::memory_order_relaxed);
+        droppedError.fetch_add(failed, std::memory_order_relaxed);
+        batch.clear();
+    }
+}
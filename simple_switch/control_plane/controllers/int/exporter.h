@@ -0,0 +1,160 @@
+#pragma once
+
+#include "kafkaProducer.h"
+#include "tcpClient.h"
+
+#include <boost/asio.hpp>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+
+/// \brief A serialized report shared by all sinks it is exported to.
+struct ExportRecord
+{
+    std::shared_ptr<const ReportTopic> topic; ///< Kafka topic of the report
+    uint64_t flowHash;  ///< Hash of the flow identity, see flowIdentityHash()
+    std::string key;    ///< Serialized telemetry.report.FlowKey
+    std::string report; ///< Serialized telemetry.report.Report
+};
+using ExportRecordPtr = std::shared_ptr<const ExportRecord>;
+
+/// \brief Counters of a sink.
+struct ExporterStats
+{
+    uint64_t exported = 0;         ///< Reports handed to the transport
+    uint64_t droppedQueueFull = 0; ///< Reports dropped because the sink's queue was full
+    uint64_t droppedError = 0;     ///< Reports lost because of transport errors
+};
+
+/// \brief Sink for INT reports.
+///
+/// Every sink buffers reports in a queue of its own and sends them from its own thread, so
+/// submit() never blocks and a slow sink does not delay the others.
+class Exporter
+{
+public:
+    virtual ~Exporter() = default;
+
+    /// \brief Human readable description of the sink, e.g., "tcp=127.0.0.1:9000".
+    virtual const std::string& name() const = 0;
+
+    /// \brief Queue a report for export. Must not block. Thread-safe.
+    /// \return False if the report was dropped.
+    virtual bool submit(const ExportRecordPtr& record) = 0;
+
+    /// \brief Prepare a sink for reports to the given topic, e.g., by creating the topic.
+    virtual void prepareTopic(const ReportTopic& topic) {}
+
+    /// \brief Stop the sink after sending or discarding queued reports. Counters remain
+    /// available. No reports may be submitted afterwards.
+    virtual void close() = 0;
+
+    virtual ExporterStats getStats() const = 0;
+};
+
+/// \brief Selects a sink type and its destination.
+struct SinkConfig
+{
+    /// One of kafka, tcp, udp, unix or file.
+    std::string type;
+    /// Broker list (kafka), "ip:port" (tcp, udp) or path (unix, file).
+    std::string address;
+};
+
+/// \brief Parse a sink given as "type=address".
+/// \exception std::invalid_argument if the string is not of the expected form.
+SinkConfig parseSinkConfig(const std::string& str);
+
+/// \brief Create a sink.
+/// \exception std::invalid_argument if the sink type is unknown.
+std::unique_ptr<Exporter> makeExporter(
+    const SinkConfig& sink, const KafkaConfig& kafkaConfig, const TcpConfig& tcpConfig);
+
+
+/// \brief Fans every report out to all configured sinks.
+/// \details Reports are copied once and the copy is shared by all sinks.
+class ExporterFanOut
+{
+public:
+    ExporterFanOut() = default;
+    ~ExporterFanOut();
+
+    void addExporter(std::unique_ptr<Exporter> exporter);
+
+    /// \brief Copy a report once and submit it to all sinks. Thread-safe.
+    void publish(std::shared_ptr<const ReportTopic> topic, uint64_t flowHash,
+        std::string_view key, std::string_view report);
+
+    /// \brief Prepare all sinks for reports to the given topic.
+    void prepareTopic(const ReportTopic& topic);
+
+    /// \brief Print the counters of all sinks.
+    void printStats() const;
+
+private:
+    std::vector<std::unique_ptr<Exporter>> exporters;
+};
+
+
+/// \brief Base class of sinks that need a queue and worker thread of their own.
+///
+/// Derived classes implement writeBatch() and must call start() at the end of their constructor
+/// and close() in their destructor.
+class QueuedExporter : public Exporter
+{
+public:
+    /// \param[in] name Description returned by name().
+    /// \param[in] maxQueuedBytes Size limit of the queue in bytes of reports.
+    /// \param[in] maxBatch Maximum number of reports passed to writeBatch() at once.
+    QueuedExporter(std::string name, size_t maxQueuedBytes, size_t maxBatch);
+
+    const std::string& name() const override { return sinkName; }
+    bool submit(const ExportRecordPtr& record) override;
+    void close() override;
+    ExporterStats getStats() const override;
+
+protected:
+    void start();
+
+    /// \brief Send a batch of reports. Called from the worker thread only.
+    /// \return Number of reports in the batch that could not be sent.
+    virtual size_t writeBatch(const std::vector<ExportRecordPtr>& batch) = 0;
+
+    /// \brief Build gather buffers prefixing every report in a batch by its length as 32-bit
+    /// unsigned integer in network byte order.
+    /// \param[out] headers Storage of the length prefixes. Must outlive the buffers.
+    static void frameBatch(const std::vector<ExportRecordPtr>& batch,
+        std::vector<uint32_t>& headers, std::vector<boost::asio::const_buffer>& buffers);
+
+    /// \brief Sleep until the given time has passed or the exporter is stopped.
+    /// \return False if the exporter is stopping.
+    bool waitFor(std::chrono::milliseconds duration);
+
+private:
+    void run();
+
+private:
+    const std::string sinkName;
+    const size_t maxQueuedBytes;
+    const size_t maxBatch;
+
+    std::mutex queueMutex;
+    std::condition_variable queueCond;
+    std::deque<ExportRecordPtr> queue;
+    size_t queuedBytes = 0;
+    bool stopping = false;
+    std::thread worker;
+
+    std::atomic<uint64_t> exported = 0;
+    std::atomic<uint64_t> droppedQueueFull = 0;
+    std::atomic<uint64_t> droppedError = 0;
+};
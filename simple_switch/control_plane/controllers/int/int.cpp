@@ -1,5 +1,5 @@
 #include "int.h"
-#include "report/report.pb.h"
+#include "intTableEntries.h"
 
 #include <p4/v1/p4data.pb.h>
 #include <p4/v1/p4runtime.pb.h>
@@ -7,8 +7,8 @@
 #include <p4/config/v1/p4info.pb.h>
 
 #include <boost/array.hpp>
-#include <boost/coroutine2/all.hpp>
 
+#include <algorithm>
 #include <iomanip>
 #include <iostream>
 #include <stdexcept>
@@ -19,56 +19,60 @@
 #include <ctime>
 #include <thread>
 #include <limits>
+#include <span>
+#include <unordered_map>
 
 
 #define CPU_PORT 128
-#define INT_IDENTIFIER 0x00494e54
 
 using p4::config::v1::P4Info;
 
-typedef boost::coroutines2::coroutine<std::chrono::milliseconds>  coroByteCnt_t;
-
 // Constants
 constexpr uint32_t NUM_SWITCH_PORTS = 8;
-
-// The IDs of actions and tables are set by @id annotations in the P4 source.
-constexpr uint32_t ACTION_INSERT_INT = 0x01002001;
-constexpr uint32_t ACTION_CLONE_INT = 0x01002002;
-constexpr uint32_t ACTION_INSERT_NODE_ID = 0x01002003;
-constexpr uint32_t ACTION_INSERT_TX_UTIL = 0x01002004;
-constexpr uint32_t ACTION_INSERT_AS_ADDR = 0x01002005;
-constexpr uint32_t TABLE_SCION_INT = 0x02002001;
-constexpr uint32_t TABLE_INT_NODE_ID = 0x02002002;
-constexpr uint32_t TABLE_INT_TX_UTIL = 0x02002003;
-constexpr uint32_t TABLE_INT_AS_ADDR = 0x02002004;
+constexpr uint32_t TX_COUNTER_SIZE = 512; // One cell per egress port
 
 // Forward declarations
-static std::unique_ptr<p4::v1::Entity> buildScionIntTableEntry(isdAddr isd, asAddr as, uint16_t bitmapInt, uint16_t bitmapScion, uint32_t defAction);
 static std::unique_ptr<p4::v1::Entity> buildSciAsAddrTableEntry(asAddr as);
 static std::unique_ptr<p4::v1::Entity> buildIntNodeIdTableEntry(nodeID_t nodeID);
 static std::unique_ptr<p4::v1::Entity> buildIntTxUtilTableEntry(Port port, LinkUtil txCount);
-static std::unique_ptr<p4::v1::Entity> buildCloneSessionEntry(uint32_t sessionId);
+static std::unique_ptr<p4::v1::Entity> buildIntMtuTableEntry(Port port, Mtu mtu);
+static std::unique_ptr<p4::v1::Entity> buildReportThresholdsEntry(const ReportFilterConfig& config);
+static std::unique_ptr<p4::v1::Entity> buildCloneSessionEntry(uint32_t sessionId, uint32_t truncateLength);
+static std::unique_ptr<p4::v1::Entity> buildDigestEntity(uint32_t digestId, const DigestConfig& config);
+static bool readIntDigest(const p4::v1::P4Data& data, IntDigest& digest);
 
-// The ID of the tc byte counter is read from the P4Info message.
+// The IDs of the counters are read from the P4Info message.
 static const char* COUNTER_TX_BYTE_NAME = "txCounter";
+static const char* COUNTER_MTU_EXCEEDED_NAME = "intMtuExceeded";
+
+// The ID of the INT digest is read from the P4Info message.
+static const char* DIGEST_INT_NAME = "intDigest_t";
 
 
 IntController::IntController(SwitchConnection& con, const p4::config::v1::P4Info &p4Info_,
-    std::string hostASStr, uint32_t nodeId, std::string intTablePath, std::string kafkaAddress, 
-    std::string tcpAddress)
+    std::string hostASStr, uint32_t nodeId, std::string intTablePath,
+    const std::vector<SinkConfig>& sinks, const KafkaConfig& kafkaConfig,
+    const TcpConfig& tcpConfig, const TxUtilConfig& txUtilConfig, const CloneConfig& cloneConfig,
+    const MtuConfig& mtuConfig, const ReportFilterConfig& reportFilterConfig,
+    const DigestConfig& digestConfig)
     : p4Info(p4Info_)
     , counterTxId(0)
+    , counterMtuExceededId(0)
+    , intDigestId(0)
     , nodeID(nodeId)
-    , kafkaProd(kafkaAddress)
+    , cloneConfig(cloneConfig)
+    , txUtilConfig(txUtilConfig)
+    , mtuConfig(mtuConfig)
+    , reportFilterConfig(reportFilterConfig)
+    , digestConfig(digestConfig)
 {
     // Get counter IDs by their names
     for (const auto& counter : p4Info.counters())
     {
         if (counter.preamble().name() == COUNTER_TX_BYTE_NAME)
-        {
             counterTxId = counter.preamble().id();
-            break;
-        }
+        else if (counter.preamble().name() == COUNTER_MTU_EXCEEDED_NAME)
+            counterMtuExceededId = counter.preamble().id();
     }
             
     // Check if all counters were defined
@@ -77,6 +81,30 @@ IntController::IntController(SwitchConnection& con, const p4::config::v1::P4Info
             std::string("P4Info does not contain a counter of the name ")
             + COUNTER_TX_BYTE_NAME);
 
+    // The tx utilization table only exists if the data plane does not compute the utilization
+    // itself (compiled with TX_UTIL_TABLE)
+    hasTxUtilTable = std::any_of(p4Info.tables().begin(), p4Info.tables().end(),
+        [](const auto& table) { return table.preamble().id() == TABLE_INT_TX_UTIL; });
+    if (!hasTxUtilTable)
+        std::cout << "Egress port utilization is computed by the data plane" << std::endl;
+
+    // Older data planes do not check the MTU
+    if (mtuConfig.mtu && !counterMtuExceededId)
+        throw std::runtime_error(
+            std::string("MTU check requested, but P4Info does not contain a counter of the name ")
+            + COUNTER_MTU_EXCEEDED_NAME);
+
+    // Older data planes can only clone INT packets to the controller
+    for (const auto& digest : p4Info.digests())
+    {
+        if (digest.preamble().name() == DIGEST_INT_NAME)
+            intDigestId = digest.preamble().id();
+    }
+    if (digestConfig.enabled && !intDigestId)
+        throw std::runtime_error(
+            std::string("INT digests requested, but P4Info does not contain a digest of the name ")
+            + DIGEST_INT_NAME);
+
     //Get address of AS and ISD the switch belongs to
     splitScionAddress(hostASStr, hostISD, hostAS);
     std::string hostASNamePart;
@@ -90,23 +118,35 @@ IntController::IntController(SwitchConnection& con, const p4::config::v1::P4Info
         hostAS = (hostAS << 16) + std::stoull("0x" + hostASNamePart, nullptr, 16);
     }
     
-    // Create tcpSocket
-    if (tcpAddress.length() > 0)
-    {
-        std::string ipAddr;
-        uint16_t port;
-        splitIpAddress(tcpAddress, ipAddr, port);
-        
-        auto addr = boost::asio::ip::make_address(ipAddr);
-        tcp::endpoint ep(addr, port);
-        tcpSocket.createClient(ep);
-    }
+    // Create report sinks
+    for (const auto& sink : sinks)
+        exporters.addExporter(makeExporter(sink, kafkaConfig, tcpConfig));
+    // Reports are generated for traffic towards the local AS, set up its topics right away
+    exporters.prepareTopic(*makeReportTopic((uint64_t(hostISD) << 48) | hostAS, false));
+    exporters.prepareTopic(*makeReportTopic((uint64_t(hostISD) << 48) | hostAS, true));
             
     // Read table from given file
-    readIntTable(intTablePath, asList, bitmapIntList, bitmapScionList);
+    readIntTable(intTablePath, asList, bitmapIntList, bitmapScionList, postcardList, samplingList);
     
     // Initialize txCount memory
-    txCountList = std::vector<uint32_t>(512, 0);
+    txCountList = std::vector<uint64_t>(TX_COUNTER_SIZE, 0);
+    txUtilList = std::vector<LinkUtil>(TX_COUNTER_SIZE, 0);
+    mtuExceededList = std::vector<uint64_t>(TX_COUNTER_SIZE, 0);
+    txReadout = std::vector<uint64_t>(TX_COUNTER_SIZE, 0);
+    mtuExceededReadout = std::vector<uint64_t>(TX_COUNTER_SIZE, 0);
+}
+
+IntController::~IntController()
+{
+    {
+        std::lock_guard<std::mutex> lock(pollMutex);
+        stopPolling = true;
+    }
+    pollCond.notify_all();
+    if (txUtilThread.joinable())
+        txUtilThread.join();
+    if (mtuExceededThread.joinable())
+        mtuExceededThread.join();
 }
 
 void IntController::handleArbitrationUpdate(
@@ -114,270 +154,422 @@ void IntController::handleArbitrationUpdate(
 {
     if (!arbUpdate.status().code())
     {
-        installStaticTableEntries(con);
-        configCloneSession(con);
+        {
+            // Only the difference between the recorded entities and the data plane is written.
+            // The tx utilization must not change until the data plane has been reconciled.
+            std::lock_guard<std::mutex> lock(txUtilMutex);
+            recordStaticTableEntries();
+            recordCloneSession();
+            recordReportFilter();
+            if (digestConfig.enabled)
+                recordDigest();
+            store.reconcile(con);
+            if (!checkCloneSession(con))
+                rewriteCloneSession(con);
+            // The counters may have been reset or kept counting while polling was paused
+            lastTxPoll = std::chrono::steady_clock::time_point();
+        }
+        {
+            std::lock_guard<std::mutex> lock(pollMutex);
+            primary = true;
+        }
+        pollCond.notify_all();
+
+        // Keep the tx utilization entries up to date from now on
+        if (hasTxUtilTable && txUtilConfig.interval.count() && !txUtilThread.joinable())
+            txUtilThread = std::thread(&IntController::txUtilLoop, this, std::ref(con));
+
+        // Report packets that could not carry INT because of the MTU
+        if (mtuConfig.mtu && mtuConfig.interval.count() && !mtuExceededThread.joinable())
+            mtuExceededThread = std::thread(&IntController::mtuExceededLoop, this, std::ref(con));
+    }
+    else
+    {
+        // Writes fail until this controller is primary again, also while reconnecting
+        std::lock_guard<std::mutex> lock(pollMutex);
+        primary = false;
     }
 }
 
+namespace {
+/// \brief Decoding and encoding state reused for every packet-in or digest handled by a thread.
+/// \details Packet-in messages may be handled by multiple threads concurrently. Since packets of
+/// the same flow are always handled by the same thread, the flow key cache is per thread as well.
+struct ReportScratch
+{
+    IntDecoder intDecoder;
+    IntReport intReport;
+    ReportEncoder reportEncoder;
+    std::unordered_map<uint64_t, std::shared_ptr<const ReportTopic>> topics; // by destination ISD-AS
+    std::unordered_map<uint64_t, std::shared_ptr<const ReportTopic>> postcardTopics;
+};
+
+thread_local ReportScratch scratch;
+}
+
+/// \brief Build the Kafka topic of reports for the given destination ISD-AS.
+/// \details Reports of INT sinks go to a topic of their own ("AS<dst>-<node ID>"). Postcards are
+/// exported by every switch on the path, they go to a topic shared by all nodes
+/// ("AS<dst>-postcards"), so that the postcards of a flow end up in the same partition.
+std::shared_ptr<const ReportTopic> IntController::makeReportTopic(
+    uint64_t dstIsdAs, bool postcards) const
+{
+    std::stringstream topic_name;
+    topic_name << "AS" << std::hex << ((dstIsdAs >> 32) % (1 << 16))
+                << "_" << std::hex << ((dstIsdAs >> 16) % (1 << 16))
+                << "_" << std::hex << (dstIsdAs % (1 << 16))
+                << "-";
+    if (postcards)
+        topic_name << "postcards";
+    else
+        topic_name << std::hex << nodeID;
+    return std::make_shared<const ReportTopic>(
+        ReportTopic{dstIsdAs, nodeID, topic_name.str(), postcards});
+}
+
+size_t IntController::flowHash(const p4::v1::PacketIn& packetIn)
+{
+    const auto& payload = packetIn.payload();
+    return IntDecoder::peekFlowId(std::as_bytes(std::span(payload.data(), payload.size())));
+}
+
 bool IntController::handlePacketIn(SwitchConnection& con, const p4::v1::PacketIn& packetIn)
 {
-    auto payload = packetIn.payload().c_str();
-    auto payloadLen = packetIn.payload().length();
-    uint32_t pos = 0;
-    
-    // Check whether the int_cpu header (16 byte length) can be existent
-    if (payloadLen < 16) {
-        std::cout << "ERROR: Received INT stack with invalid length!" << std::endl;
-        return false;
-    }
-    
-    // Get identifier and header length from int_cpu header
-    auto identifier = takeUint64(payload, pos);
-    pos += 8;
-    auto hdrLen = takeUint64(payload, pos);
-    pos += 8;
-    
-    // Check identifier
-    if (identifier != INT_IDENTIFIER)
-        return false;
-        
-    // Check if header with this lentgh can be existent in payload
-    if (payloadLen - pos < hdrLen) {
-        std::cout << "ERROR: Ill-formated data received. Cannot be read." << std::endl;
-        return false;
-    }
-    
-    // Create Protobuf for key
-    telemetry::report::FlowKey flowKey;
-    // Set flow_id to flow ID read from SCION common header
-    uint32_t flowKeyMsg = takeUint32(payload, pos);
-    flowKey.set_flow_id(flowKeyMsg % (1 << 20));
-    std::string kafkaKey;
-    if (!flowKey.SerializeToString(&kafkaKey)) {
-        std::cout << "Failed to serialize FlowKey with protobuf!" << std::endl;
+    auto& intReport = scratch.intReport;
+
+    const auto& payload = packetIn.payload();
+    auto result = scratch.intDecoder.decode(
+        std::as_bytes(std::span(payload.data(), payload.size())), intReport);
+    if (result == IntDecoder::Result::NotInt)
         return false;
-    }
-    
-    // Get destintaion ISD and AS address from int_cpu header at the front of the payload
-    auto asAddr = takeUint64(payload, (uint32_t) pos + 12);
-    
-    // Get the index of AS in the input table and read the according bitmap
-    auto bitmapInt = takeUint16(payload, (uint32_t) (pos + hdrLen - 8));
-    auto bitmapScion = takeUint16(payload, (uint32_t) (pos + hdrLen - 4));
-    
-    // Check, if payload's length is a multiple of the lengths of the defined INT fields
-    auto intStackSize = takeUint8(payload, (uint32_t) (pos + hdrLen - 12 - 3)) - 3;
-    auto intHopSize = takeUint8(payload, (uint32_t) (pos + hdrLen - 10)) % (1 << 5);
-    if ((intStackSize % intHopSize) != 0) {
+    if (result == IntDecoder::Result::Malformed) {
         std::cout << "ERROR: Received INT stack with invalid length!" << std::endl;
         return false;
     }
-    
-    // Create Kafka report basics
-    telemetry::report::Report report;
-    
-    // Move pos forward to skip the headers
-    pos += hdrLen;
-    
-    // Get INT data from INT stack
-    for (int i = 0; i < intStackSize / intHopSize; i++) {
-        // Create hop in kafka report
-        auto newHop = report.add_hops();
-        auto metadata = newHop->mutable_metadata();
-        
-        // Check for all possible INT data fields and write them into metadata
-        if (bitmapInt & (1 << 15)) // NODE_ID
-        {
-            uint32_t readNodeID = takeUint32(payload, pos);
-            pos += 4;
-            newHop->set_node_id(readNodeID);
-        }
-        if (bitmapInt & (1 << 14)) // INT_L1_IF_ID
-        {
-            for (int j = 0; j < 4; j++)
-                (*metadata)[telemetry::report::INTERFACE_LEVEL1].push_back(*(payload + pos + j));
-            pos += 4;
-        }
-        if (bitmapInt & (1 << 13)) // INT_HOP_LATENCY
-        {
-            for (int j = 0; j < 4; j++)
-                (*metadata)[telemetry::report::HOP_LATENCY].push_back(*(payload + pos + j));
-            pos += 4;
-        }
-        if (bitmapInt & (1 << 12)) // INT_QUEUE
-        {
-            for (int j = 0; j < 4; j++)
-                (*metadata)[telemetry::report::QUEUE_OCCUPANCY].push_back(*(payload + pos + j));
-            pos += 4;
-        }
-        if (bitmapInt & (1 << 11)) // INT_IG_TIME
-        {
-            auto ingressTimestamp = takeUint64(payload, pos) * 1000;
-            pos += 8;
-            //std::cout << "  Hop " << i << " - Ingress timestamp: " << std::dec << ingressTimestamp << std::endl;
-            for (int i = 7; i >= 0; i--)
-            {
-                (*metadata)[telemetry::report::INGRESS_TIMESTAMP].push_back(*(reinterpret_cast<char*>(&ingressTimestamp) + i));
-            }
-        }
-        if (bitmapInt & (1 << 10)) // INT_EG_TIME
-        {
-            auto egressTimestamp = takeUint64(payload, pos) * 1000;
-            pos += 8;
-            //std::cout << "  Hop " << i << " - Egress timestamp: " << std::dec << egressTimestamp << std::endl;
-            for (int i = 7; i >= 0; i--)
-            {
-                (*metadata)[telemetry::report::EGRESS_TIMESTAMP].push_back(*(reinterpret_cast<char*>(&egressTimestamp) + i));
-            }
-        }
-        if (bitmapInt & (1 << 9)) // INT_L2_IF_ID
-        {
-            for (int j = 0; j < 8; j++)
-                (*metadata)[telemetry::report::INTERFACE_LEVEL2].push_back(*(payload + pos + j));
-            pos += 8;
-        }
-        if (bitmapInt & (1 << 8)) // INT_EG_IF_UTIL
-        {
-            for (int j = 0; j < 4; j++)
-                (*metadata)[telemetry::report::EGRESS_TX_UTILIZATION].push_back(*(payload + pos + j));
-            pos += 4;
-        }
-        if (bitmapInt & (1 << 7)) // INT_BUFFER_INFOS
+
+    exportReport(intReport);
+    return true;
+}
+
+bool IntController::handleDigest(SwitchConnection& con, const p4::v1::DigestList& digestList)
+{
+    if (!intDigestId || digestList.digest_id() != intDigestId)
+        return false;
+
+    // Every digest in the list is exported as a report of its own
+    IntDigest digest;
+    auto& intReport = scratch.intReport;
+    for (const auto& data : digestList.data())
+    {
+        if (!readIntDigest(data, digest))
         {
-            for (int j = 0; j < 4; j++)
-                (*metadata)[telemetry::report::BUFFER_OCCUPANCY].push_back(*(payload + pos + j));
-            pos += 4;
+            std::cout << "ERROR: Invalid INT digest format" << std::endl;
+            continue;
         }
-        if (bitmapScion & 1) // AS_ADDR
+        if (scratch.intDecoder.decode(digest, intReport) != IntDecoder::Result::Ok)
         {
-            uint64_t readAS = takeUint64(payload, pos);
-            pos += 8;
-            newHop->set_asn(readAS);
+            std::cout << "ERROR: Received INT digest with invalid stack length!" << std::endl;
+            continue;
         }
+        exportReport(intReport);
     }
-    
-    // Add packet type and header to Kafka report
-    report.set_packet_type(telemetry::report::Report_PacketType_SCION);
-    report.set_truncated_packet((payload + 8), hdrLen);
-    
-    // Serialize Kafka report
-    std::string strReport;
-    if (!report.SerializeToString(&strReport)) {
-        std::cout << "Failed to serialize Report with protobuf!" << std::endl;
-        return false;
-    }
-    
-    // Send report to Kafka topic
-    std::stringstream topic_name;
-    topic_name << "AS" << std::hex << ((asAddr >> 32) % (1 << 16))
-                << "_" << std::hex << ((asAddr >> 16) % (1 << 16))
-                << "_" << std::hex << (asAddr % (1 << 16))
-                << "-" << std::hex << nodeID;
-    
-    if (!kafkaProd.send(topic_name.str(), kafkaKey, strReport))
-        std::cout << "ERROR: Failed to send message to Kafka topic" << std::endl;
-    
-    // Send protobuf message over tcp port
-    tcpSocket.send(strReport);
+
+    // The data plane holds back identical digests until the list is acknowledged
+    con.ackDigestList(digestList.digest_id(), digestList.list_id());
     return true;
 }
 
-/// \brief Install table entries that are known a priori and should not be learned.
-bool IntController::installStaticTableEntries(SwitchConnection &con)
+/// \brief Serialize a decoded report and send it to all sinks.
+void IntController::exportReport(const IntReport& intReport)
 {
-    // Create entry for broadcast address
-    auto request = con.createWriteRequest();
-    
+    auto& reportEncoder = scratch.reportEncoder;
+
+    // Serialize key and report directly into the protobuf wire format
+    auto kafkaKey = reportEncoder.flowKey(intReport.flow);
+    auto strReport = reportEncoder.encode(intReport);
+
+    // Send report to all sinks, the Kafka topic is derived from the destination AS
+    auto& topics = intReport.postcard ? scratch.postcardTopics : scratch.topics;
+    auto& topic = topics[intReport.flow.dstIsdAs];
+    if (!topic)
+        topic = makeReportTopic(intReport.flow.dstIsdAs, intReport.postcard);
+
+    // Reports are dropped if the queue of a sink is full, the sinks count them. Reports of the
+    // same flow go to the same Kafka partition. As all nodes publish postcards to the same topic,
+    // the postcards of a packet meet in one partition if all controllers are configured with the
+    // same number of partitions.
+    exporters.publish(topic, flowIdentityHash(intReport.flow), kafkaKey, strReport);
+}
+
+/// \brief Record the table entries that are known a priori in the entity store.
+/// \details The store owns the INT tables, entries of AS no longer in the INT table are removed
+/// from the data plane during reconciliation. Must be called with txUtilMutex held.
+void IntController::recordStaticTableEntries()
+{
+    store.ownTable(TABLE_SCION_INT);
+    store.ownTable(TABLE_INT_NODE_ID);
+    store.ownTable(TABLE_INT_AS_ADDR);
+    if (hasTxUtilTable)
+        store.ownTable(TABLE_INT_TX_UTIL);
+    if (mtuConfig.mtu)
+        store.ownTable(TABLE_INT_MTU);
+
     // Create entries for Scion INT table
     std::cout << "Node serves as sink for AS " << std::hex << hostAS << " of ISD " << hostISD << std::endl;
-    request.addUpdate(p4::v1::Update::INSERT, buildScionIntTableEntry(
-        hostISD,
-        hostAS, 
-        0, 0,
-        ACTION_CLONE_INT
-    ));
-    con.sendWriteRequest(request);
+    store.set(*buildIntSinkTableEntry(hostISD, hostAS, digestConfig.enabled));
     for (int i = 0; i < asList.size(); i++)
     {
-        request = con.createWriteRequest();
         std::cout << "Write INT-Bitmap " << std::hex << bitmapIntList[i] << " for AS " << (asList[i] >> 48) << "-" << (asList[i] & 0xffffffffffff) << std::endl;
         std::cout << "Write SCION-specific Bitmap " << std::hex << bitmapScionList[i] << " for AS " << (asList[i] >> 48) << "-" << (asList[i] & 0xffffffffffff) << std::endl;
+        if (postcardList[i])
+            std::cout << "Report hops in postcards (INT-MX) for AS " << (asList[i] >> 48) << "-" << (asList[i] & 0xffffffffffff) << std::endl;
+        if (samplingList[i].mode != IntSampleMode::All)
+            std::cout << "Sample INT packets (mode " << std::dec << static_cast<int>(samplingList[i].mode) << ", N = " << samplingList[i].rate << ") for AS " << std::hex << (asList[i] >> 48) << "-" << (asList[i] & 0xffffffffffff) << std::endl;
         if (!(asList[i] >> 48 == hostISD && (asList[i] & 0xffffffffffff) == hostAS))
-            request.addUpdate(p4::v1::Update::INSERT, buildScionIntTableEntry(
+            store.set(*buildScionIntTableEntry(
                 (asList[i] >> 48),
                 (asList[i] & 0xffffffffffff),
                 bitmapIntList[i],
                 bitmapScionList[i],
-                ACTION_INSERT_INT
+                postcardList[i] ? ACTION_INSERT_INT_MX : ACTION_INSERT_INT,
+                samplingList[i]
             ));
-        con.sendWriteRequest(request);
     }
     
     // Create entries for node ID and AS address
-    request = con.createWriteRequest();
-    request.addUpdate(p4::v1::Update::INSERT, buildIntNodeIdTableEntry(nodeID));
-    request.addUpdate(p4::v1::Update::INSERT, buildSciAsAddrTableEntry(hostAS));
+    store.set(*buildIntNodeIdTableEntry(nodeID));
+    store.set(*buildSciAsAddrTableEntry(hostAS));
     
-    for (int i = 0; i < 512; i++)
+    for (Port i = 0; hasTxUtilTable && i < TX_COUNTER_SIZE; i++)
     {
-        request.addUpdate(p4::v1::Update::INSERT, buildIntTxUtilTableEntry(i, 0));
+        store.set(*buildIntTxUtilTableEntry(i, txUtilList[i]));
+    }
+
+    if (mtuConfig.mtu)
+    {
+        std::cout << "Limit INT packets to an MTU of " << std::dec << mtuConfig.mtu << " bytes" << std::endl;
+        for (Port i = 0; i < NUM_SWITCH_PORTS; i++)
+            store.set(*buildIntMtuTableEntry(i, mtuConfig.mtu));
     }
-    
-    return con.sendWriteRequest(request);
 }
 
-/// \brief Configure the cloning of messages to CPU.
-bool IntController::configCloneSession(SwitchConnection &con)
+/// \brief Wait for the next round of a polling thread.
+/// \details Waits for the interval to pass while the controller is primary. If mastership is lost,
+/// waits until the controller is primary again and restarts the interval.
+/// \param[in] lock Lock of pollMutex, held when called and on return.
+/// \return False if the controller is destroyed.
+bool IntController::waitForPoll(std::unique_lock<std::mutex>& lock, std::chrono::milliseconds interval)
 {
+    while (true)
+    {
+        pollCond.wait(lock, [this] { return stopPolling || primary; });
+        if (stopPolling)
+            return false;
+        if (!pollCond.wait_for(lock, interval, [this] { return stopPolling || !primary; }))
+            return true;
+    }
+}
+
+/// \brief Poll the tx byte counter periodically until the controller is destroyed.
+void IntController::txUtilLoop(SwitchConnection& con)
+{
+    std::unique_lock<std::mutex> lock(pollMutex);
+    while (waitForPoll(lock, txUtilConfig.interval))
+    {
+        lock.unlock();
+        updateTxUtil(con);
+        lock.lock();
+    }
+}
+
+/// \brief Compute the utilization of every egress port from the tx byte counter and update the
+/// entries of the tx utilization table that have changed by at least the configured threshold.
+/// \details All counter cells are read with a single wildcard read into a flat array, all changed
+/// entries are modified with a single write request.
+/// \return True on success, false if reading the counter or writing the entries failed.
+bool IntController::updateTxUtil(SwitchConnection &con)
+{
+    std::lock_guard<std::mutex> lock(txUtilMutex);
+
+    // Cells missing from the response keep their last count
+    std::copy(txCountList.begin(), txCountList.end(), txReadout.begin());
+    CounterReadout readout{counterTxId, txReadout, {}};
+    if (!con.readCounters(std::span(&readout, 1)))
+        return false;
+
+    auto now = std::chrono::steady_clock::now();
+    bool first = lastTxPoll == std::chrono::steady_clock::time_point();
+    double seconds = std::chrono::duration<double>(now - lastTxPoll).count();
+    lastTxPoll = now;
+
     auto request = con.createWriteRequest();
-    request.addUpdate(p4::v1::Update::INSERT, buildCloneSessionEntry(1));
-    return con.sendWriteRequest(request);
+    std::vector<std::pair<Port, LinkUtil>> changed; // Modified ports and their new value
+    for (Port port = 0; port < TX_COUNTER_SIZE; ++port)
+    {
+        // A smaller count than before means the counter has been reset
+        uint64_t bytes = txReadout[port];
+        uint64_t delta = bytes >= txCountList[port] ? bytes - txCountList[port] : bytes;
+        txCountList[port] = bytes;
+        if (first || seconds <= 0)
+            continue;
+
+        double kbits = 8.0 * delta / 1000.0 / seconds;
+        auto util = static_cast<LinkUtil>(std::min<double>(kbits, std::numeric_limits<LinkUtil>::max()));
+        // Small changes are skipped, but an idle port is always reported as idle
+        auto old = txUtilList[port];
+        if (util == old || (util && (util > old ? util - old : old - util) < txUtilConfig.threshold))
+            continue;
+
+        request.addUpdate(p4::v1::Update::MODIFY, buildIntTxUtilTableEntry(port, util));
+        changed.emplace_back(port, util);
+    }
+
+    if (changed.empty())
+        return true;
+    // On failure nothing is recorded, the ports are tried again in the next round
+    if (!con.sendWriteRequest(request))
+        return false;
+    for (auto [port, util] : changed)
+    {
+        txUtilList[port] = util;
+        store.set(*buildIntTxUtilTableEntry(port, util));
+    }
+    return true;
 }
 
-/// \brief Build a configuration message describing an entry in the Scion INT table to insert an INT header.
-/// \param[in] isd Destination ISD of the INT flow to be defined.
-/// \param[in] as Destination AS of the INT flow to be defined.
-/// \param[in] bitmapInt INT bitmap of the INT flow to be defined.
-/// \param[in] bitmapScion Domain specific bitmap for SCION of the INT flow to be defined.
-/// \param[in] defAction Defines, whether INT headers have to be inserted or deleted.
-static std::unique_ptr<p4::v1::Entity> buildScionIntTableEntry(isdAddr isd, asAddr as, uint16_t bitmapInt, uint16_t bitmapScion, uint32_t defAction)
+/// \brief Poll the MTU exceeded counter periodically until the controller is destroyed.
+void IntController::mtuExceededLoop(SwitchConnection& con)
 {
-    auto entity = std::make_unique<p4::v1::Entity>();
+    std::unique_lock<std::mutex> lock(pollMutex);
+    while (waitForPoll(lock, mtuConfig.interval))
+    {
+        lock.unlock();
+        readMtuExceeded(con);
+        lock.lock();
+    }
+}
 
-    auto entry = entity->mutable_table_entry();
-    entry->set_table_id(TABLE_SCION_INT);
-
-    // Match rules
-    // Set match field 1 (ISD address)
-    auto matchIsd = entry->add_match();
-    matchIsd->set_field_id(1);
-    auto exactMatchIsd = matchIsd->mutable_exact();
-    toBitstring<ISD_BYTES, isdAddr>(isd, *exactMatchIsd->mutable_value());
-    
-    // Set match field 2 (AS address)
-    auto matchAs = entry->add_match();
-    matchAs->set_field_id(2);
-    auto exactMatchAs = matchAs->mutable_exact();
-    toBitstring<AS_BYTES, asAddr>(as, *exactMatchAs->mutable_value());
-    
-    if (defAction == ACTION_INSERT_INT)
+/// \brief Read the packets of every egress port that exceeded the MTU and print the ports on which
+/// new packets were counted since the last read.
+/// \details Frequent events indicate that the INT bitmaps or NUM_INTER_HOPS are too large for the
+/// MTU of the network.
+/// \return True on success, false if reading the counter failed.
+bool IntController::readMtuExceeded(SwitchConnection& con)
+{
+    std::copy(mtuExceededList.begin(), mtuExceededList.end(), mtuExceededReadout.begin());
+    CounterReadout readout{counterMtuExceededId, {}, mtuExceededReadout};
+    if (!con.readCounters(std::span(&readout, 1)))
+        return false;
+
+    for (Port port = 0; port < TX_COUNTER_SIZE; ++port)
+    {
+        uint64_t packets = mtuExceededReadout[port];
+        if (packets == mtuExceededList[port])
+            continue;
+        // A smaller count than before means the counter has been reset
+        uint64_t delta = packets > mtuExceededList[port] ? packets - mtuExceededList[port] : packets;
+        mtuExceededList[port] = packets;
+        std::cout << "Port " << std::dec << port << ": INT skipped for " << delta
+            << " packets exceeding the MTU (total " << packets << ")" << std::endl;
+    }
+    return true;
+}
+
+/// \brief Record the clone session cloning messages to the CPU.
+void IntController::recordCloneSession()
+{
+    auto length = cloneTruncationLength();
+    std::cout << "Truncate INT clones to " << std::dec << length << " bytes" << std::endl;
+    store.set(*buildCloneSessionEntry(1, length));
+}
+
+/// \brief Check that the switch truncates INT clones to the recorded length.
+/// \details Targets without support for truncation reject the clone session or ignore its length.
+/// The clones then carry the whole packet to the controller.
+/// \return True if the clone session exists with the recorded length.
+bool IntController::checkCloneSession(SwitchConnection& con)
+{
+    p4::v1::Entity read;
+    auto session = read.mutable_packet_replication_engine_entry()->mutable_clone_session_entry();
+    session->set_session_id(1);
+    std::vector<p4::v1::Entity> entities;
+    if (!con.sendReadRequest(read, entities) || entities.empty())
     {
-        // Action
-        auto action = entry->mutable_action()->mutable_action();
-        action->set_action_id(ACTION_INSERT_INT);
-        auto param = action->add_params();
-        param->set_param_id(1);
-        toBitstring<sizeof(uint16_t)>(bitmapInt, *param->mutable_value());
-        param = action->add_params();
-        param->set_param_id(2);
-        toBitstring<sizeof(uint16_t)>(bitmapScion, *param->mutable_value());
-    } else if (defAction == ACTION_CLONE_INT) {
-        // Action
-        auto action = entry->mutable_action()->mutable_action();
-        action->set_action_id(ACTION_CLONE_INT);
+        std::cout << "ERROR: INT clone session was not written to the switch" << std::endl;
+        return false;
     }
 
-    return entity;
+    auto length = cloneTruncationLength();
+    const auto& written = entities.front().packet_replication_engine_entry().clone_session_entry();
+    if (static_cast<uint32_t>(written.packet_length_bytes()) != length)
+    {
+        std::cout << "ERROR: Switch truncates INT clones to " << std::dec
+            << written.packet_length_bytes() << " bytes instead of " << length << std::endl;
+        return false;
+    }
+    return true;
+}
+
+/// \brief Write the INT clone session again after checkCloneSession() failed.
+/// \details The session is modified if it exists and inserted otherwise. If the switch still does
+/// not report the recorded length, it does not support truncation. The data plane cuts the clones
+/// after the INT stack on its own then.
+void IntController::rewriteCloneSession(SwitchConnection& con)
+{
+    std::cout << "Rewriting the INT clone session" << std::endl;
+    auto length = cloneTruncationLength();
+    auto modify = con.createWriteRequest();
+    modify.addUpdate(p4::v1::Update::MODIFY, buildCloneSessionEntry(1, length));
+    if (!con.sendWriteRequest(modify))
+    {
+        auto insert = con.createWriteRequest();
+        insert.addUpdate(p4::v1::Update::INSERT, buildCloneSessionEntry(1, length));
+        if (!con.sendWriteRequest(insert))
+        {
+            std::cout << "ERROR: Failed to write the INT clone session" << std::endl;
+            return;
+        }
+    }
+    if (!checkCloneSession(con))
+        std::cout << "ERROR: Switch does not truncate INT clones, they are only cut by the data plane"
+            << std::endl;
+}
+
+/// \brief Record the thresholds of change-triggered reporting.
+/// \details Nothing is recorded if the refresh interval is zero, the sink reports every packet then.
+void IntController::recordReportFilter()
+{
+    if (!reportFilterConfig.refresh.count())
+        return;
+    std::cout << "Report flows on changes of the hop latency by more than " << std::dec
+        << reportFilterConfig.latencyDelta << " us or of the queue occupancy by more than "
+        << reportFilterConfig.queueDelta << " packets, at least every "
+        << reportFilterConfig.refresh.count() << " ms" << std::endl;
+    store.set(*buildReportThresholdsEntry(reportFilterConfig));
+}
+
+/// \brief Record the batching of INT digests.
+void IntController::recordDigest()
+{
+    std::cout << "Send INT reports in digest lists of up to " << std::dec
+        << digestConfig.maxListSize << " digests, waiting at most "
+        << digestConfig.maxTimeout.count() << " us" << std::endl;
+    store.set(*buildDigestEntity(intDigestId, digestConfig));
+}
+
+/// \brief Length of the longest INT packet headers the sink sends to the controller.
+/// \details The INT stack holds the metadata of the source and of up to the configured number of
+/// further hops, using the largest hop of all bitmaps in the INT table.
+uint32_t IntController::cloneTruncationLength() const
+{
+    uint32_t hopBytes = 0;
+    for (size_t i = 0; i < bitmapIntList.size(); ++i)
+    {
+        auto layout = IntHopLayout::make(bitmapIntList[i], bitmapScionList[i]);
+        hopBytes = std::max<uint32_t>(hopBytes, layout.hopBytes);
+    }
+    return INT_CPU_HDR_BYTES + cloneConfig.maxScionHeaderBytes + UDP_HDR_BYTES
+        + INT_SHIM_HDR_BYTES + INT_MD_HDR_BYTES + (cloneConfig.maxHops + 1) * hopBytes;
 }
 
 /// \brief Build a configuration message describing an entry in the int node ID table set to insert_int_node_id.
@@ -430,9 +622,9 @@ static std::unique_ptr<p4::v1::Entity> buildSciAsAddrTableEntry(asAddr as)
     return entity;
 }
 
-/// \brief Build a configuration message describing an entry in the int tx link utilization table set to insert_sci_as_addr.
+/// \brief Build a configuration message describing an entry in the int tx link utilization table set to insert_int_eg_if_util.
 /// \param[in] port Egress port of the message
-/// \param[in] txCount Tx byte count of the corresponding port.
+/// \param[in] txCount Tx utilization of the corresponding port in kbit/s.
 static std::unique_ptr<p4::v1::Entity> buildIntTxUtilTableEntry(Port port, LinkUtil txCount)
 {
     auto entity = std::make_unique<p4::v1::Entity>();
@@ -461,9 +653,64 @@ static std::unique_ptr<p4::v1::Entity> buildIntTxUtilTableEntry(Port port, LinkU
     return entity;
 }
 
+/// \brief Build a configuration message describing an entry in the int MTU table.
+/// \param[in] port Egress port
+/// \param[in] mtu Maximum size of IP packets leaving the port in bytes.
+static std::unique_ptr<p4::v1::Entity> buildIntMtuTableEntry(Port port, Mtu mtu)
+{
+    auto entity = std::make_unique<p4::v1::Entity>();
+
+    auto entry = entity->mutable_table_entry();
+    entry->set_table_id(TABLE_INT_MTU);
+
+    // Match rule: The egress port has to match.
+    auto match = entry->add_match();
+    match->set_field_id(1);
+    auto exactMatch = match->mutable_exact();
+    toBitstring<PORT_BYTES, Port>(port, *exactMatch->mutable_value());
+
+    // Action
+    auto action = entry->mutable_action()->mutable_action();
+    action->set_action_id(ACTION_SET_MTU);
+    auto param = action->add_params();
+    param->set_param_id(1);
+    toBitstring<MTU_BYTES, Mtu>(mtu, *param->mutable_value());
+
+    return entity;
+}
+
+/// \brief Build a configuration message setting the default action of the report thresholds table.
+/// \param[in] config Thresholds. The refresh interval is converted to microseconds, the unit of the
+/// data plane timestamps.
+static std::unique_ptr<p4::v1::Entity> buildReportThresholdsEntry(const ReportFilterConfig& config)
+{
+    auto entity = std::make_unique<p4::v1::Entity>();
+
+    auto entry = entity->mutable_table_entry();
+    entry->set_table_id(TABLE_INT_REPORT_THRESHOLDS);
+    entry->set_is_default_action(true);
+
+    // Action
+    auto action = entry->mutable_action()->mutable_action();
+    action->set_action_id(ACTION_SET_REPORT_THRESHOLDS);
+    auto param = action->add_params();
+    param->set_param_id(1);
+    toBitstring<4, uint32_t>(config.latencyDelta, *param->mutable_value());
+    param = action->add_params();
+    param->set_param_id(2);
+    toBitstring<4, uint32_t>(config.queueDelta, *param->mutable_value());
+    param = action->add_params();
+    param->set_param_id(3);
+    auto refresh = std::chrono::duration_cast<std::chrono::microseconds>(config.refresh).count();
+    toBitstring<6, uint64_t>(refresh, *param->mutable_value());
+
+    return entity;
+}
+
 /// \brief Build a configuration message for a clone session entry cloning the message to the CPU-port.
 /// \param[in] id session ID. Must be larger than zero.
-static std::unique_ptr<p4::v1::Entity> buildCloneSessionEntry(uint32_t id)
+/// \param[in] truncateLength Maximum length of the clones in bytes. Zero keeps the whole packet.
+static std::unique_ptr<p4::v1::Entity> buildCloneSessionEntry(uint32_t id, uint32_t truncateLength)
 {
     auto entity = std::make_unique<p4::v1::Entity>();
 
@@ -477,7 +724,67 @@ static std::unique_ptr<p4::v1::Entity> buildCloneSessionEntry(uint32_t id)
     replica->set_instance(1);
     
     cloneSession->set_class_of_service(0);
-    cloneSession->set_packet_length_bytes(0);
+    cloneSession->set_packet_length_bytes(truncateLength);
 
     return entity;
 }
+
+/// \brief Build a configuration message configuring the batching of the INT digest.
+/// \param[in] digestId ID of the digest extern to configure.
+/// \param[in] config List size and timeouts.
+static std::unique_ptr<p4::v1::Entity> buildDigestEntity(uint32_t digestId, const DigestConfig& config)
+{
+    using std::chrono::nanoseconds;
+    auto entity = std::make_unique<p4::v1::Entity>();
+
+    auto entry = entity->mutable_digest_entry();
+    entry->set_digest_id(digestId);
+    auto digestConfig = entry->mutable_config();
+    digestConfig->set_max_list_size(config.maxListSize);
+    digestConfig->set_max_timeout_ns(nanoseconds(config.maxTimeout).count());
+    digestConfig->set_ack_timeout_ns(nanoseconds(config.ackTimeout).count());
+
+    return entity;
+}
+
+/// \brief Copy a bitstring into a zero-padded host address.
+/// \details Bitstrings may omit leading zero bytes, they are aligned to the end of the address.
+static void hostFromBitstring(const std::string& bitstring, std::array<std::byte, 16>& host)
+{
+    host = {};
+    size_t n = std::min(bitstring.size(), host.size());
+    std::transform(bitstring.end() - n, bitstring.end(), host.end() - n,
+        [](char c) { return static_cast<std::byte>(c); });
+}
+
+/// \brief Read the members of an INT digest (intDigest_t).
+/// \return False if the digest does not have the expected format.
+static bool readIntDigest(const p4::v1::P4Data& data, IntDigest& digest)
+{
+    constexpr int INT_DIGEST_MEMBERS = 20;
+    if (!data.has_struct_() || data.struct_().members_size() != INT_DIGEST_MEMBERS)
+        return false;
+    const auto& members = data.struct_().members();
+
+    digest.dstIsdAs = (fromBitstring<2, uint64_t>(members[0].bitstring()) << 48)
+        | fromBitstring<6, uint64_t>(members[1].bitstring());
+    digest.srcIsdAs = (fromBitstring<2, uint64_t>(members[2].bitstring()) << 48)
+        | fromBitstring<6, uint64_t>(members[3].bitstring());
+    digest.flowId = fromBitstring<3, uint32_t>(members[4].bitstring());
+    digest.protocol = fromBitstring<1, uint8_t>(members[5].bitstring());
+    digest.dstHostType = fromBitstring<1, uint8_t>(members[6].bitstring());
+    digest.srcHostType = fromBitstring<1, uint8_t>(members[7].bitstring());
+    hostFromBitstring(members[8].bitstring(), digest.dstHost);
+    hostFromBitstring(members[9].bitstring(), digest.srcHost);
+    digest.srcPort = fromBitstring<2, uint16_t>(members[10].bitstring());
+    digest.dstPort = fromBitstring<2, uint16_t>(members[11].bitstring());
+    digest.bitmapInt = fromBitstring<2, uint16_t>(members[12].bitstring());
+    digest.bitmapScion = fromBitstring<2, uint16_t>(members[13].bitstring());
+    digest.hopML = fromBitstring<1, uint8_t>(members[14].bitstring());
+    digest.stackBits = fromBitstring<4, uint32_t>(members[15].bitstring());
+    digest.nodeId = fromBitstring<4, uint32_t>(members[16].bitstring());
+    digest.l1IfId = fromBitstring<4, uint32_t>(members[17].bitstring());
+    digest.hopLatency = fromBitstring<4, uint32_t>(members[18].bitstring());
+    digest.queue = fromBitstring<4, uint32_t>(members[19].bitstring());
+    return true;
+}
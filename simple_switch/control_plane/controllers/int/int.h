@@ -1,13 +1,15 @@
 #pragma once
 
 #include "controller.h"
-#include "kafkaProducer.h"
-#include "tcpClient.h"
+#include "entity_store.h"
+#include "exporter.h"
 #include "commonInt.h"
 #include "bitstring.h"
 #include "takeUint.h"
 #include "addressConversion.h"
 #include "readIntTable.h"
+#include "intDecoder.h"
+#include "reportEncoder.h"
 
 #include <p4/v1/p4runtime.pb.h>
 #include <p4/v1/p4runtime.grpc.pb.h>
@@ -15,16 +17,90 @@
 
 #include <boost/array.hpp>
 
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
 #include <vector>
-#include <boost/coroutine2/all.hpp>
 
 
+/// \brief Settings of the egress port utilization poller.
+/// \details Only used if the data plane takes the utilization from a table (TX_UTIL_TABLE).
+struct TxUtilConfig
+{
+    /// Interval between two reads of the tx byte counter. Zero disables the poller.
+    std::chrono::milliseconds interval = std::chrono::milliseconds(1000);
+    /// Minimum change of the utilization in kbit/s for the table entry of a port to be updated.
+    LinkUtil threshold = 100;
+};
+
+/// \brief Settings of the MTU check of the data plane.
+/// \details INT headers and metadata are not added to packets that would exceed the MTU of their
+/// egress port. These packets are counted per port.
+struct MtuConfig
+{
+    /// MTU of all switch ports in bytes, i.e., the maximum size of the IP packet. Zero disables the
+    /// check.
+    Mtu mtu = 0;
+    /// Interval between two reads of the MTU exceeded counter. Zero disables the poller.
+    std::chrono::milliseconds interval = std::chrono::milliseconds(10000);
+};
+
+/// \brief Thresholds of change-triggered reporting at the INT sink.
+/// \details The sink only clones a packet to the controller if the number of hops changed, the hop
+/// latency or queue occupancy of the hop closest to the sink changed by more than the given delta
+/// or the last report of the flow is older than the refresh interval.
+struct ReportFilterConfig
+{
+    /// Minimum change of the hop latency in microseconds.
+    uint32_t latencyDelta = 0;
+    /// Minimum change of the queue occupancy in packets.
+    uint32_t queueDelta = 0;
+    /// Maximum time between two reports of a flow. Zero reports every packet.
+    std::chrono::milliseconds refresh = std::chrono::milliseconds(0);
+};
+
+/// \brief Settings of INT digests.
+/// \details If enabled, the INT sink sends the first hop of INT stacks to the controller in
+/// digests instead of cloning the packets. The data plane collects digests in lists until the list
+/// is full or the oldest digest in it reaches the timeout.
+struct DigestConfig
+{
+    /// Send digests instead of packet-in messages.
+    bool enabled = false;
+    /// Maximum number of digests in a list.
+    uint32_t maxListSize = 64;
+    /// Maximum time a digest waits for more digests.
+    std::chrono::microseconds maxTimeout = std::chrono::microseconds(1000);
+    /// Time the data plane waits for the acknowledgement of a list before it may send the same
+    /// digests again.
+    std::chrono::microseconds ackTimeout = std::chrono::microseconds(10000);
+};
+
+/// \brief Limits of the INT packets the sink clones to the controller.
+/// \details Clones are truncated to the longest possible SCION, UDP and INT headers plus the
+/// INT stack, the payload of the packets is never sent to the controller.
+struct CloneConfig
+{
+    /// Maximum number of hops after the INT source. Must match NUM_INTER_HOPS of the data plane.
+    uint32_t maxHops = 10;
+    /// Maximum length of the SCION header in bytes. The header length field of the SCION common
+    /// header limits it to 1020 bytes.
+    uint32_t maxScionHeaderBytes = 1020;
+};
+
 class IntController : public Controller
 {
 public:
     IntController(SwitchConnection& con, const p4::config::v1::P4Info &p4Info_,
-        std::string hostASStr, uint32_t nodeId, std::string intTablePath, std::string kafkaAddress, 
-        std::string tcpAddress);
+        std::string hostASStr, uint32_t nodeId, std::string intTablePath,
+        const std::vector<SinkConfig>& sinks, const KafkaConfig& kafkaConfig = KafkaConfig(),
+        const TcpConfig& tcpConfig = TcpConfig(), const TxUtilConfig& txUtilConfig = TxUtilConfig(),
+        const CloneConfig& cloneConfig = CloneConfig(), const MtuConfig& mtuConfig = MtuConfig(),
+        const ReportFilterConfig& reportFilterConfig = ReportFilterConfig(),
+        const DigestConfig& digestConfig = DigestConfig());
+    ~IntController();
 
 public:
     /// \name Stream Message Handlers
@@ -32,27 +108,72 @@ public:
     void handleArbitrationUpdate(
         SwitchConnection &con, const p4::v1::MasterArbitrationUpdate& arbUpdate) override;
     bool handlePacketIn(SwitchConnection& con, const p4::v1::PacketIn& packetIn) override;
+    bool handleDigest(SwitchConnection& con, const p4::v1::DigestList& digestList) override;
     ///@}
+
+    /// \brief Flow hash for ControlPlane::setPipeline() keeping reports of a SCION flow in order.
+    static size_t flowHash(const p4::v1::PacketIn& packetIn);
     
 private:
     /// \name Initialization Functions
     ///@{
-    bool installStaticTableEntries(SwitchConnection &con);
-    bool configCloneSession(SwitchConnection &con);
+    void recordStaticTableEntries();
+    void recordCloneSession();
+    bool checkCloneSession(SwitchConnection& con);
+    void rewriteCloneSession(SwitchConnection& con);
+    void recordReportFilter();
+    void recordDigest();
+    uint32_t cloneTruncationLength() const;
     ///@}
     
-    void updateTxUtil();
+    /// \name Egress Port Utilization
+    ///@{
+    bool waitForPoll(std::unique_lock<std::mutex>& lock, std::chrono::milliseconds interval);
+    void txUtilLoop(SwitchConnection& con);
+    bool updateTxUtil(SwitchConnection& con);
+    ///@}
+
+    /// \name MTU Check
+    ///@{
+    void mtuExceededLoop(SwitchConnection& con);
+    bool readMtuExceeded(SwitchConnection& con);
+    ///@}
+
+    std::shared_ptr<const ReportTopic> makeReportTopic(uint64_t dstIsdAs, bool postcards) const;
+    void exportReport(const IntReport& intReport);
 
 private:
     p4::config::v1::P4Info p4Info;
     uint32_t counterTxId;
+    uint32_t counterMtuExceededId;
+    uint32_t intDigestId;
     uint32_t nodeID;
     uint64_t hostAS;
     uint16_t hostISD;
-    std::vector<uint32_t> txCountList;
+    const CloneConfig cloneConfig;
+    const TxUtilConfig txUtilConfig;
+    const MtuConfig mtuConfig;
+    const ReportFilterConfig reportFilterConfig;
+    const DigestConfig digestConfig;
+    bool hasTxUtilTable;
+    std::vector<uint64_t> txCountList; // Last byte count of each port
+    std::vector<uint64_t> txReadout;   // Byte counts of the current read
+    std::vector<LinkUtil> txUtilList;  // Utilization of each port in the data plane
+    std::chrono::steady_clock::time_point lastTxPoll;
+    std::mutex txUtilMutex; // Guards the tx utilization state and its entries in the store
+    std::thread txUtilThread;
+    std::vector<uint64_t> mtuExceededList; // Packets of each port that exceeded the MTU
+    std::vector<uint64_t> mtuExceededReadout;
+    std::thread mtuExceededThread;
+    std::mutex pollMutex;
+    std::condition_variable pollCond;
+    bool stopPolling = false;
+    bool primary = false; // Polling pauses while the controller is not primary
     std::vector<uint64_t> asList;
     std::vector<uint16_t> bitmapIntList;
     std::vector<uint16_t> bitmapScionList;
-    kafkaProducer kafkaProd;  // Used for Kafka topics output
-    tcpClient tcpSocket;      // Used for output over tcp port
+    std::vector<bool> postcardList; // INT-MX instead of INT-MD
+    std::vector<IntSampling> samplingList;
+    ExporterFanOut exporters; // Kafka, TCP, UDP, Unix socket and file outputs
+    EntityStore store; // Entities this controller maintains in the data plane
 };
@@ -0,0 +1,506 @@
+#pragma once
+
+#include "takeUint.h"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <span>
+#include <vector>
+
+
+// Fixed header sizes of the packet-in messages generated by the INT sink
+constexpr size_t INT_CPU_HDR_BYTES = 16;
+constexpr size_t INT_SHIM_HDR_BYTES = 4;
+constexpr size_t INT_MD_HDR_BYTES = 12;
+constexpr size_t SCION_COMMON_HDR_BYTES = 12;
+constexpr size_t SCION_ADDR_COMMON_BYTES = 16;
+constexpr size_t UDP_HDR_BYTES = 8;
+
+// Instruction bits of the fields the INT sink sends in digests (node ID, level 1 interface IDs,
+// hop latency and queue)
+constexpr uint16_t INT_DIGEST_INSTRUCTIONS = 0xf000;
+// Minimum length of the stack for the INT sink to look ahead at the first hop in bits
+constexpr uint32_t INT_DIGEST_MIN_STACK_BITS = 128;
+
+// Type of the INT shim header of postcards (INT-MX)
+constexpr uint8_t INT_SHIM_TYPE_MX = 3;
+
+// Host address types (DT/DL) of the SCION address header
+constexpr uint8_t SCION_HOST_IPV4 = 0x0;
+constexpr uint8_t SCION_HOST_IPV6 = 0x3;
+
+/// Identifier the data plane writes into the int_cpu header of cloned INT packets.
+constexpr uint64_t INT_CPU_IDENTIFIER = 0x00494e54;
+
+/// \brief Metadata fields of an INT hop in the order they appear on the wire.
+enum IntField : unsigned
+{
+    INT_FIELD_NODE_ID,
+    INT_FIELD_L1_IF_ID,
+    INT_FIELD_HOP_LATENCY,
+    INT_FIELD_QUEUE,
+    INT_FIELD_INGRESS_TIME,
+    INT_FIELD_EGRESS_TIME,
+    INT_FIELD_L2_IF_ID,
+    INT_FIELD_EG_IF_UTIL,
+    INT_FIELD_BUFFER_INFOS,
+    INT_FIELD_AS_ADDR,  // SCION domain-specific
+    INT_FIELD_COUNT
+};
+
+/// Size of each metadata field in bytes.
+constexpr std::array<uint8_t, INT_FIELD_COUNT> INT_FIELD_BYTES = {4, 4, 4, 4, 8, 8, 8, 4, 4, 8};
+
+/// \brief Test whether a field is requested by the given instruction and domain bitmaps.
+constexpr bool intFieldEnabled(IntField field, uint16_t bitmapInt, uint16_t bitmapScion)
+{
+    if (field == INT_FIELD_AS_ADDR)
+        return bitmapScion & 0x0001;
+    return bitmapInt & (0x8000 >> field);
+}
+
+
+/// \brief Metadata of a single INT hop in host byte order.
+/// \details Only the fields enabled by the instruction bitmap of the report are valid.
+struct IntHop
+{
+    uint32_t nodeId;
+    uint32_t l1IfId;
+    uint32_t hopLatency;
+    uint32_t queue;
+    uint64_t ingressTime;
+    uint64_t egressTime;
+    uint64_t l2IfId;
+    uint32_t egIfUtil;
+    uint32_t bufferInfos;
+    uint64_t asAddr;
+};
+
+struct IntHopLayout;
+using IntHopDecodeFn = void (*)(const IntHopLayout&, const std::byte*, size_t, IntHop*);
+
+/// \brief Byte offsets of the metadata fields within a hop. Computed once per bitmap pair.
+struct IntHopLayout
+{
+    uint16_t bitmapInt = 0;
+    uint16_t bitmapScion = 0;
+    /// Total size of the metadata of one hop in bytes.
+    uint8_t hopBytes = 0;
+    /// Offset of each field relative to the start of the hop. Only valid if the field is enabled.
+    std::array<uint8_t, INT_FIELD_COUNT> offset = {};
+    /// Hop decoder specialized for this layout.
+    IntHopDecodeFn decodeHops = nullptr;
+
+    constexpr bool has(IntField field) const
+    {
+        return intFieldEnabled(field, bitmapInt, bitmapScion);
+    }
+
+    static constexpr IntHopLayout make(uint16_t bitmapInt, uint16_t bitmapScion)
+    {
+        IntHopLayout layout;
+        layout.bitmapInt = bitmapInt;
+        layout.bitmapScion = bitmapScion;
+        for (unsigned f = 0; f < INT_FIELD_COUNT; ++f)
+        {
+            if (intFieldEnabled(static_cast<IntField>(f), bitmapInt, bitmapScion))
+            {
+                layout.offset[f] = layout.hopBytes;
+                layout.hopBytes += INT_FIELD_BYTES[f];
+            }
+        }
+        return layout;
+    }
+};
+
+
+namespace detail {
+
+/// \brief Decode a single hop. Fields are selected at compile time if the layout is a constant
+/// expression and at runtime otherwise.
+template <typename Has>
+inline void decodeHop(const IntHopLayout& l, Has has, const std::byte* p, IntHop& hop)
+{
+    if (has(INT_FIELD_NODE_ID))
+        hop.nodeId = loadBigEndian<uint32_t>(p + l.offset[INT_FIELD_NODE_ID]);
+    if (has(INT_FIELD_L1_IF_ID))
+        hop.l1IfId = loadBigEndian<uint32_t>(p + l.offset[INT_FIELD_L1_IF_ID]);
+    if (has(INT_FIELD_HOP_LATENCY))
+        hop.hopLatency = loadBigEndian<uint32_t>(p + l.offset[INT_FIELD_HOP_LATENCY]);
+    if (has(INT_FIELD_QUEUE))
+        hop.queue = loadBigEndian<uint32_t>(p + l.offset[INT_FIELD_QUEUE]);
+    if (has(INT_FIELD_INGRESS_TIME))
+        hop.ingressTime = loadBigEndian<uint64_t>(p + l.offset[INT_FIELD_INGRESS_TIME]);
+    if (has(INT_FIELD_EGRESS_TIME))
+        hop.egressTime = loadBigEndian<uint64_t>(p + l.offset[INT_FIELD_EGRESS_TIME]);
+    if (has(INT_FIELD_L2_IF_ID))
+        hop.l2IfId = loadBigEndian<uint64_t>(p + l.offset[INT_FIELD_L2_IF_ID]);
+    if (has(INT_FIELD_EG_IF_UTIL))
+        hop.egIfUtil = loadBigEndian<uint32_t>(p + l.offset[INT_FIELD_EG_IF_UTIL]);
+    if (has(INT_FIELD_BUFFER_INFOS))
+        hop.bufferInfos = loadBigEndian<uint32_t>(p + l.offset[INT_FIELD_BUFFER_INFOS]);
+    if (has(INT_FIELD_AS_ADDR))
+        hop.asAddr = loadBigEndian<uint64_t>(p + l.offset[INT_FIELD_AS_ADDR]);
+}
+
+/// \brief Hop decoder for arbitrary bitmaps.
+inline void decodeHopsGeneric(
+    const IntHopLayout& layout, const std::byte* stack, size_t hopCount, IntHop* hops)
+{
+    auto has = [&layout](IntField f) { return layout.has(f); };
+    for (size_t i = 0; i < hopCount; ++i, stack += layout.hopBytes)
+        decodeHop(layout, has, stack, hops[i]);
+}
+
+/// \brief Hop decoder with the field selection and offsets resolved at compile time.
+template <uint16_t BitmapInt, uint16_t BitmapScion>
+void decodeHopsStatic(const IntHopLayout&, const std::byte* stack, size_t hopCount, IntHop* hops)
+{
+    static constexpr IntHopLayout layout = IntHopLayout::make(BitmapInt, BitmapScion);
+    auto has = [](IntField f) constexpr { return intFieldEnabled(f, BitmapInt, BitmapScion); };
+    for (size_t i = 0; i < hopCount; ++i, stack += layout.hopBytes)
+        decodeHop(layout, has, stack, hops[i]);
+}
+
+/// \brief Set of bitmap pairs (instruction bitmap in the upper, domain bitmap in the lower 16 bits)
+/// for which a specialized decoder is instantiated.
+template <uint32_t... Bitmaps>
+struct IntHopDecoders
+{
+    static IntHopDecodeFn lookup(uint16_t bitmapInt, uint16_t bitmapScion)
+    {
+        const uint32_t key = (static_cast<uint32_t>(bitmapInt) << 16) | bitmapScion;
+        IntHopDecodeFn fn = &decodeHopsGeneric;
+        ((key == Bitmaps ? (fn = &decodeHopsStatic<(Bitmaps >> 16), (Bitmaps & 0xffff)>, true)
+            : false) || ...);
+        return fn;
+    }
+};
+
+} // namespace detail
+
+/// Bitmaps used in the deployed INT tables (see scion/int_table*.txt).
+using DeployedIntHopDecoders = detail::IntHopDecoders<
+    0x8d000001, // node ID, ingress + egress timestamp, tx utilization, AS address
+    0x8d000000  // node ID, ingress + egress timestamp, tx utilization
+>;
+
+
+/// \brief Identity of the flow an INT report belongs to, taken from the SCION and UDP headers.
+/// \details Used as the Kafka key of reports and to assign flows to partitions.
+struct FlowIdentity
+{
+    /// Destination and source ISD and AS address from the SCION address header
+    uint64_t dstIsdAs = 0;
+    uint64_t srcIsdAs = 0;
+    /// 20-bit flow ID from the SCION common header
+    uint32_t flowId = 0;
+    /// Original UDP destination port saved in the INT shim header
+    uint16_t dstPort = 0;
+    /// UDP source port
+    uint16_t srcPort = 0;
+    /// Next header field of the SCION common header
+    uint8_t protocol = 0;
+    /// Type and length of the host addresses as in the DT/DL and ST/SL fields
+    uint8_t dstHostType = 0;
+    uint8_t srcHostType = 0;
+    /// Host addresses, zero-padded to 16 bytes
+    std::array<std::byte, 16> dstHost = {};
+    std::array<std::byte, 16> srcHost = {};
+
+    bool operator==(const FlowIdentity&) const = default;
+
+    /// \brief Length of a host address of the given type in bytes.
+    static constexpr size_t hostBytes(uint8_t hostType) { return 4 * ((hostType & 0x3) + 1); }
+    /// \brief Test whether a host address is an IPv4 address.
+    static constexpr bool isIpv4(uint8_t hostType) { return hostType == SCION_HOST_IPV4; }
+    /// \brief Test whether a host address is an IPv6 address.
+    static constexpr bool isIpv6(uint8_t hostType) { return hostType == SCION_HOST_IPV6; }
+};
+
+/// \brief Decoded content of an INT packet-in message.
+/// \details The spans point into the buffer passed to IntDecoder::decode() and are only valid as
+/// long as that buffer is.
+struct IntReport
+{
+    /// Flow the reported packet belongs to
+    FlowIdentity flow;
+    /// SCION, UDP, INT shim and INT-MD headers
+    std::span<const std::byte> headers;
+    /// Layout of the metadata in each hop. Owned by the decoder, valid until its next decode().
+    const IntHopLayout* layout = nullptr;
+    /// Decoded metadata. Data from the hop closest to the INT sink comes first.
+    std::vector<IntHop> hops;
+    /// Postcard of a single hop (INT-MX) instead of the stack collected at the INT sink
+    bool postcard = false;
+    /// Sequence number the INT source assigned to the packet. Only valid for postcards.
+    uint16_t sequence = 0;
+};
+
+
+/// \brief Content of an INT digest (intDigest_t) sent by the INT sink in host byte order.
+/// \details The data plane cannot access individual hops of the INT stack, so the digest only
+/// carries the first four fields of the hop closest to the sink.
+struct IntDigest
+{
+    uint64_t dstIsdAs = 0;
+    uint64_t srcIsdAs = 0;
+    uint32_t flowId = 0;
+    uint8_t protocol = 0;
+    uint8_t dstHostType = 0;
+    uint8_t srcHostType = 0;
+    /// Host addresses, zero-padded to 16 bytes
+    std::array<std::byte, 16> dstHost = {};
+    std::array<std::byte, 16> srcHost = {};
+    uint16_t srcPort = 0;
+    uint16_t dstPort = 0;
+    uint16_t bitmapInt = 0;
+    uint16_t bitmapScion = 0;
+    /// Length of the metadata of one hop in 4-byte words
+    uint8_t hopML = 0;
+    /// Length of the INT stack in bits
+    uint32_t stackBits = 0;
+    uint32_t nodeId = 0;
+    uint32_t l1IfId = 0;
+    uint32_t hopLatency = 0;
+    uint32_t queue = 0;
+};
+
+
+/// \brief Hash of the identity of a flow.
+/// \details Combines all fields of the identity. Reports of the same flow always get the same
+/// hash, so they are exported to the same Kafka partition.
+inline uint64_t flowIdentityHash(const FlowIdentity& flow)
+{
+    // Finalizer of MurmurHash3, spreads every input bit over the whole hash
+    auto mix = [](uint64_t h) {
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdull;
+        h ^= h >> 33;
+        h *= 0xc4ceb9fe1a85ec53ull;
+        h ^= h >> 33;
+        return h;
+    };
+    auto mixHost = [&mix](uint64_t h, const std::array<std::byte, 16>& host) {
+        h = mix(h ^ loadBigEndian<uint64_t>(host.data()));
+        return mix(h ^ loadBigEndian<uint64_t>(host.data() + 8));
+    };
+    uint64_t h = mix(flow.srcIsdAs);
+    h = mix(h ^ flow.dstIsdAs);
+    h = mix(h ^ ((static_cast<uint64_t>(flow.flowId) << 32)
+        | (static_cast<uint64_t>(flow.srcPort) << 16) | flow.dstPort));
+    h = mix(h ^ ((static_cast<uint64_t>(flow.protocol) << 16)
+        | (static_cast<uint64_t>(flow.dstHostType) << 8) | flow.srcHostType));
+    h = mixHost(h, flow.dstHost);
+    return mixHost(h, flow.srcHost);
+}
+
+/// \brief Hash function object for containers keyed by FlowIdentity.
+struct FlowIdentityHash
+{
+    size_t operator()(const FlowIdentity& flow) const { return flowIdentityHash(flow); }
+};
+
+/// \brief Decoder for the INT stacks the INT sink sends to the controller as packet-in or digest.
+///
+/// The per-hop layout is computed once for every distinct pair of bitmaps and cached. Hops are
+/// decoded directly from the packet-in payload without intermediate copies.
+class IntDecoder
+{
+public:
+    enum class Result
+    {
+        Ok,
+        NotInt,    ///< Payload does not start with an int_cpu header
+        Malformed, ///< Lengths in the headers are inconsistent with the payload
+    };
+
+    /// Maximum number of distinct bitmap pairs whose layouts are cached.
+    static constexpr size_t MAX_CACHED_LAYOUTS = 64;
+
+    /// \brief Decode an INT packet-in payload.
+    /// \param[in] payload Payload of the packet-in message starting with the int_cpu header.
+    /// \param[out] report Decoded report. The hop vector is reused to avoid allocations.
+    Result decode(std::span<const std::byte> payload, IntReport& report)
+    {
+        // int_cpu header: identifier (8 bytes), length of the following headers (8 bytes)
+        if (payload.size() < INT_CPU_HDR_BYTES)
+            return Result::Malformed;
+        if (loadBigEndian<uint64_t>(payload.data()) != INT_CPU_IDENTIFIER)
+            return Result::NotInt;
+        auto hdrLen = loadBigEndian<uint64_t>(payload.data() + 8);
+        if (hdrLen > payload.size() - INT_CPU_HDR_BYTES
+            || hdrLen < SCION_COMMON_HDR_BYTES + SCION_ADDR_COMMON_BYTES
+                + UDP_HDR_BYTES + INT_SHIM_HDR_BYTES + INT_MD_HDR_BYTES)
+            return Result::Malformed;
+
+        auto headers = payload.subspan(INT_CPU_HDR_BYTES, hdrLen);
+        auto stack = payload.subspan(INT_CPU_HDR_BYTES + hdrLen);
+        report.headers = headers;
+
+        // SCION common header: flow ID in the lower 20 bits of the first word, next header at
+        // byte 4, host address types and lengths at byte 9
+        auto& flow = report.flow;
+        flow.flowId = loadBigEndian<uint32_t>(headers.data()) & 0x000fffff;
+        flow.protocol = std::to_integer<uint8_t>(headers[4]);
+        auto hostTypes = std::to_integer<uint8_t>(headers[9]);
+        flow.dstHostType = hostTypes >> 4;
+        flow.srcHostType = hostTypes & 0x0f;
+
+        // SCION address header: ISD-AS addresses followed by the host addresses
+        auto addr = headers.data() + SCION_COMMON_HDR_BYTES;
+        flow.dstIsdAs = loadBigEndian<uint64_t>(addr);
+        flow.srcIsdAs = loadBigEndian<uint64_t>(addr + 8);
+        size_t dstHostBytes = FlowIdentity::hostBytes(flow.dstHostType);
+        size_t srcHostBytes = FlowIdentity::hostBytes(flow.srcHostType);
+        if (hdrLen < SCION_COMMON_HDR_BYTES + SCION_ADDR_COMMON_BYTES + dstHostBytes + srcHostBytes
+            + UDP_HDR_BYTES + INT_SHIM_HDR_BYTES + INT_MD_HDR_BYTES)
+            return Result::Malformed;
+        auto dstHost = addr + SCION_ADDR_COMMON_BYTES;
+        auto srcHost = dstHost + dstHostBytes;
+        flow.dstHost = {};
+        flow.srcHost = {};
+        std::copy_n(dstHost, dstHostBytes, flow.dstHost.begin());
+        std::copy_n(srcHost, srcHostBytes, flow.srcHost.begin());
+
+        // UDP, INT shim and INT-MD header are located at the end of the headers
+        auto md = headers.data() + hdrLen - INT_MD_HDR_BYTES;
+        auto shim = md - INT_SHIM_HDR_BYTES;
+        auto udp = shim - UDP_HDR_BYTES;
+        flow.srcPort = loadBigEndian<uint16_t>(udp);
+        flow.dstPort = loadBigEndian<uint16_t>(shim + 2);
+        size_t stackBytes = 4 * static_cast<size_t>(std::to_integer<uint8_t>(shim[1]));
+        size_t hopBytes = 4 * (std::to_integer<uint8_t>(md[2]) & 0x1f);
+        auto bitmapInt = loadBigEndian<uint16_t>(md + 4);
+        auto bitmapScion = loadBigEndian<uint16_t>(md + 8);
+
+        // Postcards carry the sequence number of the packet in the domain-specific flags
+        report.postcard = (std::to_integer<uint8_t>(shim[0]) >> 4) == INT_SHIM_TYPE_MX;
+        report.sequence = report.postcard ? loadBigEndian<uint16_t>(md + 10) : 0;
+
+        // The shim length covers the INT-MD header and the stack, but not the shim itself
+        if (stackBytes < INT_MD_HDR_BYTES)
+            return Result::Malformed;
+        stackBytes -= INT_MD_HDR_BYTES;
+        if (stackBytes > stack.size())
+            return Result::Malformed;
+
+        const auto& layout = layoutFor(bitmapInt, bitmapScion);
+        report.layout = &layout;
+        if (stackBytes == 0)
+        {
+            report.hops.clear();
+            return Result::Ok;
+        }
+        if (hopBytes == 0 || hopBytes != layout.hopBytes || stackBytes % hopBytes != 0)
+            return Result::Malformed;
+
+        size_t hopCount = stackBytes / hopBytes;
+        report.hops.resize(hopCount);
+        layout.decodeHops(layout, stack.data(), hopCount, report.hops.data());
+        return Result::Ok;
+    }
+
+    /// \brief Decode an INT digest.
+    /// \details The report contains at most the hop closest to the sink with the fields of
+    /// INT_DIGEST_INSTRUCTIONS and no truncated packet. Stacks too short for the data plane to
+    /// look ahead at the first hop are reported without hops.
+    /// \param[in] digest Digest received from the INT sink.
+    /// \param[out] report Decoded report. The hop vector is reused to avoid allocations.
+    Result decode(const IntDigest& digest, IntReport& report)
+    {
+        auto& flow = report.flow;
+        flow.dstIsdAs = digest.dstIsdAs;
+        flow.srcIsdAs = digest.srcIsdAs;
+        flow.flowId = digest.flowId & 0x000fffff;
+        flow.protocol = digest.protocol;
+        flow.dstHostType = digest.dstHostType & 0x0f;
+        flow.srcHostType = digest.srcHostType & 0x0f;
+        flow.dstHost = {};
+        flow.srcHost = {};
+        std::copy_n(digest.dstHost.begin(), FlowIdentity::hostBytes(flow.dstHostType),
+            flow.dstHost.begin());
+        std::copy_n(digest.srcHost.begin(), FlowIdentity::hostBytes(flow.srcHostType),
+            flow.srcHost.begin());
+        flow.srcPort = digest.srcPort;
+        flow.dstPort = digest.dstPort;
+
+        report.headers = {};
+        report.postcard = false;
+        report.sequence = 0;
+        const auto& layout = layoutFor(digest.bitmapInt & INT_DIGEST_INSTRUCTIONS, 0);
+        report.layout = &layout;
+
+        size_t hopBits = 32 * static_cast<size_t>(digest.hopML);
+        if (digest.stackBits != 0 && (hopBits == 0 || digest.stackBits % hopBits != 0))
+            return Result::Malformed;
+        if (digest.stackBits < INT_DIGEST_MIN_STACK_BITS)
+        {
+            report.hops.clear();
+            return Result::Ok;
+        }
+
+        report.hops.resize(1);
+        auto& hop = report.hops.front();
+        hop = IntHop{};
+        hop.nodeId = digest.nodeId;
+        hop.l1IfId = digest.l1IfId;
+        hop.hopLatency = digest.hopLatency;
+        hop.queue = digest.queue;
+        return Result::Ok;
+    }
+
+    /// \brief Extract only the SCION flow ID from an INT packet-in payload.
+    /// \return The 20-bit flow ID or zero if the payload is not a valid INT packet-in.
+    static uint32_t peekFlowId(std::span<const std::byte> payload)
+    {
+        if (payload.size() < INT_CPU_HDR_BYTES + SCION_COMMON_HDR_BYTES)
+            return 0;
+        if (loadBigEndian<uint64_t>(payload.data()) != INT_CPU_IDENTIFIER)
+            return 0;
+        return loadBigEndian<uint32_t>(payload.data() + INT_CPU_HDR_BYTES) & 0x000fffff;
+    }
+
+private:
+    /// \brief Get the layout of hops with the given bitmaps.
+    /// \details Layouts are cached, since both bitmaps come from the packets the cache is bounded.
+    /// Once it is full, layouts of other bitmaps are built on every call and the returned reference
+    /// is only valid until the next call.
+    const IntHopLayout& layoutFor(uint16_t bitmapInt, uint16_t bitmapScion)
+    {
+        // Packets to the same sink almost always use the same bitmaps
+        if (lastLayout < layouts.size() && layouts[lastLayout].bitmapInt == bitmapInt
+            && layouts[lastLayout].bitmapScion == bitmapScion)
+            return layouts[lastLayout];
+
+        for (size_t i = 0; i < layouts.size(); ++i)
+        {
+            if (layouts[i].bitmapInt == bitmapInt && layouts[i].bitmapScion == bitmapScion)
+            {
+                lastLayout = i;
+                return layouts[i];
+            }
+        }
+
+        auto layout = IntHopLayout::make(bitmapInt, bitmapScion);
+        layout.decodeHops = DeployedIntHopDecoders::lookup(bitmapInt, bitmapScion);
+        if (layouts.size() >= MAX_CACHED_LAYOUTS)
+        {
+            uncachedLayout = layout;
+            return uncachedLayout;
+        }
+        lastLayout = layouts.size();
+        layouts.push_back(layout);
+        return layouts.back();
+    }
+
+private:
+    // Deque keeps references handed out in IntReport valid when new layouts are added
+    std::deque<IntHopLayout> layouts;
+    size_t lastLayout = 0;
+    // Layout of bitmaps that did not fit into the cache
+    IntHopLayout uncachedLayout;
+};
@@ -0,0 +1,95 @@
+#pragma once
+
+#include "bitstring.h"
+#include "commonInt.h"
+
+#include <p4/v1/p4runtime.pb.h>
+
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+
+
+// The IDs of actions and tables are set by @id annotations in the P4 source.
+constexpr uint32_t ACTION_INSERT_INT = 0x01002001;
+constexpr uint32_t ACTION_CLONE_INT = 0x01002002;
+constexpr uint32_t ACTION_INSERT_NODE_ID = 0x01002003;
+constexpr uint32_t ACTION_INSERT_TX_UTIL = 0x01002004;
+constexpr uint32_t ACTION_INSERT_AS_ADDR = 0x01002005;
+constexpr uint32_t ACTION_INSERT_INT_MX = 0x01002006;
+constexpr uint32_t ACTION_SET_MTU = 0x01002007;
+constexpr uint32_t ACTION_SET_REPORT_THRESHOLDS = 0x01002008;
+constexpr uint32_t ACTION_DIGEST_INT = 0x01002009;
+constexpr uint32_t TABLE_SCION_INT = 0x02002001;
+constexpr uint32_t TABLE_INT_NODE_ID = 0x02002002;
+constexpr uint32_t TABLE_INT_TX_UTIL = 0x02002003;
+constexpr uint32_t TABLE_INT_AS_ADDR = 0x02002004;
+constexpr uint32_t TABLE_INT_MTU = 0x02002005;
+constexpr uint32_t TABLE_INT_REPORT_THRESHOLDS = 0x02002006;
+
+
+/// \brief Build a configuration message describing an entry in the Scion INT table to insert an INT header.
+/// \param[in] isd Destination ISD of the INT flow to be defined.
+/// \param[in] as Destination AS of the INT flow to be defined.
+/// \param[in] bitmapInt INT bitmap of the INT flow to be defined.
+/// \param[in] bitmapScion Domain specific bitmap for SCION of the INT flow to be defined.
+/// \param[in] defAction Defines, whether INT-MD or INT-MX headers have to be inserted or INT has to be
+/// removed and reported by cloning (ACTION_CLONE_INT) or in a digest (ACTION_DIGEST_INT).
+/// \exception std::invalid_argument if the action is none of these.
+/// \param[in] sampling Packets INT headers are inserted into.
+inline std::unique_ptr<p4::v1::Entity> buildScionIntTableEntry(isdAddr isd, asAddr as, uint16_t bitmapInt, uint16_t bitmapScion, uint32_t defAction, IntSampling sampling = IntSampling())
+{
+    auto entity = std::make_unique<p4::v1::Entity>();
+
+    auto entry = entity->mutable_table_entry();
+    entry->set_table_id(TABLE_SCION_INT);
+
+    // Match rules
+    // Set match field 1 (ISD address)
+    auto matchIsd = entry->add_match();
+    matchIsd->set_field_id(1);
+    auto exactMatchIsd = matchIsd->mutable_exact();
+    toBitstring<ISD_BYTES, isdAddr>(isd, *exactMatchIsd->mutable_value());
+    
+    // Set match field 2 (AS address)
+    auto matchAs = entry->add_match();
+    matchAs->set_field_id(2);
+    auto exactMatchAs = matchAs->mutable_exact();
+    toBitstring<AS_BYTES, asAddr>(as, *exactMatchAs->mutable_value());
+    
+    if (defAction == ACTION_INSERT_INT || defAction == ACTION_INSERT_INT_MX)
+    {
+        // Action
+        auto action = entry->mutable_action()->mutable_action();
+        action->set_action_id(defAction);
+        auto param = action->add_params();
+        param->set_param_id(1);
+        toBitstring<sizeof(uint16_t)>(bitmapInt, *param->mutable_value());
+        param = action->add_params();
+        param->set_param_id(2);
+        toBitstring<sizeof(uint16_t)>(bitmapScion, *param->mutable_value());
+        param = action->add_params();
+        param->set_param_id(3);
+        toBitstring<sizeof(uint8_t)>(static_cast<uint8_t>(sampling.mode), *param->mutable_value());
+        param = action->add_params();
+        param->set_param_id(4);
+        toBitstring<sizeof(uint16_t)>(sampling.rate, *param->mutable_value());
+    } else if (defAction == ACTION_CLONE_INT || defAction == ACTION_DIGEST_INT) {
+        // Action
+        auto action = entry->mutable_action()->mutable_action();
+        action->set_action_id(defAction);
+    } else {
+        throw std::invalid_argument("Unknown action of the Scion INT table");
+    }
+
+    return entity;
+}
+
+/// \brief Build the entry of the Scion INT table for the AS of the INT sink.
+/// \param[in] isd ISD of the sink.
+/// \param[in] as AS of the sink.
+/// \param[in] digest Report INT in digests instead of clones to the CPU.
+inline std::unique_ptr<p4::v1::Entity> buildIntSinkTableEntry(isdAddr isd, asAddr as, bool digest)
+{
+    return buildScionIntTableEntry(isd, as, 0, 0, digest ? ACTION_DIGEST_INT : ACTION_CLONE_INT);
+}
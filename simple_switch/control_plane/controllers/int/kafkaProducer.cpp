@@ -1,17 +1,344 @@
 #include "kafkaProducer.h"
 #include <cppkafka/cppkafka.h>
 
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+
+
+// The flow hash of a report is carried in the opaque pointer of its message, so it is still known
+// if the delivery fails. The partition is no substitute, it is unassigned if partitioning is left
+// to librdkafka.
+static_assert(sizeof(void*) >= sizeof(uint64_t), "Flow hash does not fit into message opaque");
+
+static void* flowHashOpaque(uint64_t flowHash)
+{
+    return reinterpret_cast<void*>(static_cast<uintptr_t>(flowHash));
+}
+
+
+/// \brief Translate the exporter settings into a librdkafka configuration.
+static cppkafka::Configuration makeKafkaConfiguration(const KafkaConfig& config)
+{
+    return cppkafka::Configuration({
+        { "bootstrap.servers", config.brokers },
+        { "linger.ms", std::to_string(config.lingerMs) },
+        { "batch.size", std::to_string(config.batchSize) },
+        { "compression.type", config.compression },
+        { "queue.buffering.max.messages", std::to_string(config.maxQueuedReports) },
+        { "queue.buffering.max.kbytes", std::to_string(config.maxQueuedKBytes) },
+        { "message.timeout.ms", std::to_string(config.messageTimeout.count()) },
+    });
+}
 
 // Constructor for Kafka Producer
-kafkaProducer::kafkaProducer(const std::string& kafkaAddress) : kafkaConfig({{ "bootstrap.servers", kafkaAddress }}), kafkaProd(kafkaConfig)
+kafkaProducer::kafkaProducer(const KafkaConfig& config_)
+    : config(config_)
+    , kafkaProd(makeKafkaConfiguration(config_)
+        .set_delivery_report_callback([this](cppkafka::Producer&, const cppkafka::Message& msg) {
+            onDelivery(msg);
+        })
+        .set_error_callback([this](cppkafka::KafkaHandleBase&, int error, const std::string&) {
+            if (error == RD_KAFKA_RESP_ERR__ALL_BROKERS_DOWN)
+                brokerUp = false;
+        }))
 {
+    if (!config.spoolDirectory.empty())
+    {
+        spool = std::make_unique<ReportSpool>(SpoolConfig{
+            config.spoolDirectory, config.spoolSegmentBytes, config.spoolMaxBytes});
+    }
+    pollThread = std::thread(&kafkaProducer::pollLoop, this);
+    if (spool)
+        replayThread = std::thread(&kafkaProducer::replayLoop, this);
 }
 
-bool kafkaProducer::send(const std::string& topic_name,
-                    const std::string& key, 
-                    const std::string& report)
+kafkaProducer::~kafkaProducer()
 {
-    kafkaProd.produce(cppkafka::MessageBuilder(topic_name).key(key).payload(report));
-    
+    close();
+
+    // Topic handles must be released before the producer
+    for (auto& [key, handle] : topics)
+        rd_kafka_topic_destroy(handle);
+}
+
+void kafkaProducer::close()
+{
+    if (!pollThread.joinable())
+        return;
+    stopPolling = true;
+    pollThread.join();
+    if (replayThread.joinable())
+        replayThread.join();
+
+    // Deliver everything still queued before the producer is destroyed
+    try {
+        if (!kafkaProd.flush(config.flushTimeout))
+        {
+            if (spool)
+            {
+                // Purged reports are passed to the delivery report callback, which spools them
+                rd_kafka_purge(kafkaProd.get_handle(), RD_KAFKA_PURGE_F_QUEUE | RD_KAFKA_PURGE_F_INFLIGHT);
+                kafkaProd.poll(std::chrono::milliseconds(0));
+            }
+            else
+            {
+                std::cout << "Kafka: " << kafkaProd.get_out_queue_length()
+                    << " reports not delivered before shutdown" << std::endl;
+            }
+        }
+    }
+    catch (cppkafka::Exception& e) {
+        std::cout << "Kafka: Flush failed: " << e.what() << std::endl;
+    }
+    printStats();
+}
+
+bool kafkaProducer::send(const ReportTopic& topic, uint64_t flowHash,
+                    std::string_view key,
+                    std::string_view report)
+{
+    // Keep the producer's memory bounded while the broker is down or falling behind
+    if (spool && (!brokerUp || kafkaProd.get_out_queue_length() > static_cast<int>(config.spoolWatermark)))
+        return spoolReport(topic.name, flowHash, key, report);
+
+    // Produce to the cached topic handle, the payload is copied as the caller reuses its buffers
+    int res = rd_kafka_produce(topicHandle(topic), partitionOf(flowHash), RD_KAFKA_MSG_F_COPY,
+        const_cast<char*>(report.data()), report.size(), key.data(), key.size(),
+        flowHashOpaque(flowHash));
+    if (res != 0)
+    {
+        auto err = rd_kafka_last_error();
+        if (spool && err == RD_KAFKA_RESP_ERR__QUEUE_FULL)
+            return spoolReport(topic.name, flowHash, key, report);
+        if (err == RD_KAFKA_RESP_ERR__QUEUE_FULL)
+            droppedQueueFull.fetch_add(1, std::memory_order_relaxed);
+        else
+            droppedError.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    queued.fetch_add(1, std::memory_order_relaxed);
     return true;
 }
+
+void kafkaProducer::prepareTopic(const ReportTopic& topic)
+{
+    topicHandle(topic);
+}
+
+int32_t kafkaProducer::partitionOf(uint64_t flowHash) const
+{
+    if (config.partitions <= 0)
+        return RD_KAFKA_PARTITION_UA;
+    return static_cast<int32_t>(flowHash % config.partitions);
+}
+
+/// \brief Get the cached handle of a topic. Creates the topic on first use if enabled.
+rd_kafka_topic_t* kafkaProducer::topicHandle(const ReportTopic& topic)
+{
+    TopicKey key{topic.dstIsdAs, topic.nodeId, topic.postcards};
+    {
+        std::shared_lock<std::shared_mutex> lock(topicMutex);
+        auto i = topics.find(key);
+        if (i != topics.end())
+            return i->second;
+    }
+
+    std::unique_lock<std::shared_mutex> lock(topicMutex);
+    auto i = topics.find(key);
+    if (i != topics.end())
+        return i->second;
+    if (config.createTopics)
+        createTopic(topic.name);
+    auto handle = rd_kafka_topic_new(kafkaProd.get_handle(), topic.name.c_str(), nullptr);
+    topics.emplace(key, handle);
+    return handle;
+}
+
+/// \brief Create a topic with the configured number of partitions. Blocks until the broker
+/// responds. A topic that already exists is left as it is.
+void kafkaProducer::createTopic(const std::string& name)
+{
+    constexpr int TIMEOUT_MS = 10000;
+    char errstr[512];
+    int32_t partitions = config.partitions > 0 ? config.partitions : 1;
+    auto newTopic = rd_kafka_NewTopic_new(name.c_str(), partitions, config.replicationFactor,
+        errstr, sizeof(errstr));
+    if (!newTopic)
+    {
+        std::cout << "Kafka: Cannot create topic " << name << ": " << errstr << std::endl;
+        return;
+    }
+
+    auto queue = rd_kafka_queue_new(kafkaProd.get_handle());
+    rd_kafka_CreateTopics(kafkaProd.get_handle(), &newTopic, 1, nullptr, queue);
+    auto event = rd_kafka_queue_poll(queue, TIMEOUT_MS);
+    auto result = event ? rd_kafka_event_CreateTopics_result(event) : nullptr;
+    if (result)
+    {
+        size_t count = 0;
+        auto topicResults = rd_kafka_CreateTopics_result_topics(result, &count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            auto err = rd_kafka_topic_result_error(topicResults[i]);
+            if (err == RD_KAFKA_RESP_ERR_NO_ERROR)
+            {
+                std::cout << "Kafka: Created topic " << name << " with " << std::dec
+                    << partitions << " partitions" << std::endl;
+            }
+            else if (err != RD_KAFKA_RESP_ERR_TOPIC_ALREADY_EXISTS)
+            {
+                std::cout << "Kafka: Cannot create topic " << name << ": "
+                    << rd_kafka_topic_result_error_string(topicResults[i]) << std::endl;
+            }
+        }
+    }
+    else
+    {
+        std::cout << "Kafka: Timeout while creating topic " << name << std::endl;
+    }
+
+    if (event)
+        rd_kafka_event_destroy(event);
+    rd_kafka_queue_destroy(queue);
+    rd_kafka_NewTopic_destroy(newTopic);
+}
+
+KafkaStats kafkaProducer::getStats() const
+{
+    KafkaStats stats;
+    stats.queued = queued.load(std::memory_order_relaxed);
+    stats.delivered = delivered.load(std::memory_order_relaxed);
+    stats.failed = failed.load(std::memory_order_relaxed);
+    stats.spooled = spooled.load(std::memory_order_relaxed);
+    stats.replayed = replayed.load(std::memory_order_relaxed);
+    stats.droppedQueueFull = droppedQueueFull.load(std::memory_order_relaxed)
+        + (spool ? spool->getDropped() : 0);
+    stats.droppedError = droppedError.load(std::memory_order_relaxed);
+    stats.latencySumUs = latencySumUs.load(std::memory_order_relaxed);
+    stats.latencyMaxUs = latencyMaxUs.load(std::memory_order_relaxed);
+    return stats;
+}
+
+/// \brief Delivery report callback. Invoked from poll() and flush().
+void kafkaProducer::onDelivery(const cppkafka::Message& msg)
+{
+    if (msg.get_error())
+    {
+        brokerUp = false;
+
+        // Keep the report for a later attempt
+        if (spool)
+        {
+            const auto& key = msg.get_key();
+            const auto& payload = msg.get_payload();
+            auto flowHash = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(msg.get_user_data()));
+            spoolReport(msg.get_topic(), flowHash,
+                std::string_view(reinterpret_cast<const char*>(key.get_data()), key.get_size()),
+                std::string_view(reinterpret_cast<const char*>(payload.get_data()), payload.get_size()));
+            return;
+        }
+
+        // Only the first failure is printed to avoid flooding the log if the broker is down
+        if (failed.fetch_add(1, std::memory_order_relaxed) == 0)
+        {
+            std::cout << "Kafka: Delivery to " << msg.get_topic() << " failed: "
+                << msg.get_error().to_string() << std::endl;
+        }
+        return;
+    }
+    brokerUp = true;
+
+    // Time from produce() until the broker acknowledged the report
+    uint64_t latency = msg.get_latency().count();
+    latencySumUs.fetch_add(latency, std::memory_order_relaxed);
+    if (latency > latencyMaxUs.load(std::memory_order_relaxed))
+        latencyMaxUs.store(latency, std::memory_order_relaxed);
+    delivered.fetch_add(1, std::memory_order_relaxed);
+}
+
+/// \brief Serve delivery reports until the producer is destroyed.
+void kafkaProducer::pollLoop()
+{
+    auto nextStats = std::chrono::steady_clock::now() + config.statsInterval;
+    while (!stopPolling)
+    {
+        kafkaProd.poll(config.pollInterval);
+
+        if (config.statsInterval.count() && std::chrono::steady_clock::now() >= nextStats)
+        {
+            printStats();
+            nextStats += config.statsInterval;
+        }
+    }
+}
+
+/// \brief Write a report to the spool.
+bool kafkaProducer::spoolReport(std::string_view topic, uint64_t flowHash, std::string_view key, std::string_view report)
+{
+    if (!spool->append(topic, flowHash, key, report))
+        return false;
+    spooled.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+/// \brief Feed spooled reports back to the producer at the configured rate.
+/// \details While the broker is considered down, a single report is sent every second to probe
+/// whether it is reachable again. A successful delivery marks the broker as up.
+void kafkaProducer::replayLoop()
+{
+    constexpr auto TICK = std::chrono::milliseconds(10);
+    constexpr auto PROBE_INTERVAL = std::chrono::seconds(1);
+    const uint32_t reportsPerTick = std::max<uint32_t>(1, config.replayRate * TICK / std::chrono::seconds(1));
+
+    SpoolRecord record;
+    while (!stopPolling)
+    {
+        bool up = brokerUp;
+        uint32_t budget = up ? reportsPerTick : 1;
+        for (uint32_t i = 0; i < budget && spool->front(record); ++i)
+        {
+            if (kafkaProd.get_out_queue_length() > static_cast<int>(config.spoolWatermark))
+                break;
+            try {
+                kafkaProd.produce(cppkafka::MessageBuilder(std::string(record.topic))
+                    .partition(partitionOf(record.flowHash))
+                    .user_data(flowHashOpaque(record.flowHash))
+                    .key(cppkafka::Buffer(record.key.data(), record.key.size()))
+                    .payload(cppkafka::Buffer(record.report.data(), record.report.size())));
+            }
+            catch (cppkafka::HandleException&) {
+                break;
+            }
+            spool->pop();
+            replayed.fetch_add(1, std::memory_order_relaxed);
+        }
+        if (up)
+            std::this_thread::sleep_for(TICK);
+        else
+            std::this_thread::sleep_for(PROBE_INTERVAL);
+    }
+}
+
+void kafkaProducer::printStats() const
+{
+    auto stats = getStats();
+    std::cout << std::dec << "Kafka: queued " << stats.queued
+        << ", delivered " << stats.delivered
+        << ", failed " << stats.failed;
+    if (spool)
+    {
+        std::cout << ", spooled " << stats.spooled
+            << ", replayed " << stats.replayed
+            << ", pending in spool " << spool->size();
+    }
+    std::cout
+        << ", dropped (queue full) " << stats.droppedQueueFull
+        << ", dropped (error) " << stats.droppedError;
+    if (stats.delivered)
+    {
+        std::cout << ", latency avg " << stats.latencySumUs / stats.delivered
+            << " us, max " << stats.latencyMaxUs << " us";
+    }
+    std::cout << std::endl;
+}
@@ -1,14 +1,171 @@
 #pragma once
 
+#include "reportSpool.h"
+
 #include <cppkafka/cppkafka.h>
 
-// Class that holds a Kafka producer
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+
+/// \brief Settings of the Kafka exporter.
+struct KafkaConfig
+{
+    /// Comma-separated list of bootstrap brokers ("host:port").
+    std::string brokers;
+    /// Time to wait for more reports before a batch is sent (linger.ms).
+    uint32_t lingerMs = 5;
+    /// Maximum size of a batch in bytes (batch.size).
+    uint32_t batchSize = 1 << 20;
+    /// Compression codec: none, gzip, snappy, lz4 or zstd (compression.type).
+    std::string compression = "lz4";
+    /// Maximum number of reports buffered in the producer. Further reports are dropped.
+    uint32_t maxQueuedReports = 100000;
+    /// Maximum total size of the reports buffered in the producer in KiB.
+    uint32_t maxQueuedKBytes = 256 * 1024;
+    /// Interval in which the background thread serves delivery reports.
+    std::chrono::milliseconds pollInterval{100};
+    /// Time after which the producer gives up delivering a report (message.timeout.ms).
+    std::chrono::milliseconds messageTimeout{30000};
+    /// Maximum time to wait for outstanding reports on shutdown.
+    std::chrono::milliseconds flushTimeout{5000};
+    /// Interval in which statistics are printed. Zero disables periodic statistics.
+    std::chrono::seconds statsInterval{0};
+
+    /// Directory of the spool keeping reports while the broker is unreachable. An empty string
+    /// disables the spool.
+    std::string spoolDirectory;
+    /// Size of a spool segment file in bytes.
+    size_t spoolSegmentBytes = 64 << 20;
+    /// Maximum total size of the spool in bytes.
+    size_t spoolMaxBytes = size_t(1) << 30;
+    /// Reports are spooled instead of queued in the producer if it holds more reports than this.
+    uint32_t spoolWatermark = 80000;
+    /// Maximum rate in reports per second at which spooled reports are sent to the broker.
+    uint32_t replayRate = 10000;
+
+    /// Number of partitions reports are spread over by the hash of their flow identity. Must not
+    /// exceed the number of partitions of the topics. Zero leaves partitioning to librdkafka.
+    int32_t partitions = 0;
+    /// Create topics with the configured number of partitions before the first report is sent.
+    bool createTopics = false;
+    /// Replication factor of created topics.
+    int32_t replicationFactor = 1;
+};
+
+/// \brief Kafka topic of the reports an INT sink node exports for a destination AS.
+/// \details Postcards are not specific to a node, the postcards all switches on the path export
+/// for a destination AS share one topic.
+struct ReportTopic
+{
+    uint64_t dstIsdAs;
+    uint32_t nodeId;
+    std::string name;
+    bool postcards = false;
+};
+
+/// \brief Counters of the Kafka exporter.
+struct KafkaStats
+{
+    uint64_t queued = 0;           ///< Reports accepted by the producer
+    uint64_t delivered = 0;        ///< Reports acknowledged by the broker
+    uint64_t failed = 0;           ///< Reports the producer gave up on (e.g. timeouts)
+    uint64_t spooled = 0;          ///< Reports written to the spool, including failed deliveries
+    uint64_t replayed = 0;         ///< Reports read from the spool and queued again
+    uint64_t droppedQueueFull = 0; ///< Reports dropped because the local queue or spool was full
+    uint64_t droppedError = 0;     ///< Reports rejected by produce() for other reasons
+    uint64_t latencySumUs = 0;     ///< Sum of the delivery latencies of delivered reports
+    uint64_t latencyMaxUs = 0;     ///< Highest delivery latency observed
+};
+
+/// \brief Asynchronous Kafka producer for INT reports.
+///
+/// Reports are handed to librdkafka, which batches and compresses them per partition. A
+/// background thread serves delivery reports to keep the statistics up to date. The local queue
+/// is bounded; if it is full, reports are dropped and counted instead of blocking the caller.
+/// Outstanding reports are flushed when the producer is destroyed.
+///
+/// If a spool is configured, reports are written to the spool instead of being dropped while the
+/// broker is unreachable or the local queue is above a watermark. Reports whose delivery failed
+/// are spooled as well. A replay thread feeds the spooled reports back to the producer at a
+/// limited rate once the broker is reachable again.
 class kafkaProducer
 {
     public:
-        kafkaProducer(const std::string& kafkaAddress);
-        bool send(const std::string& topic_name, const std::string& key, const std::string& report);
+        kafkaProducer(const KafkaConfig& config);
+        ~kafkaProducer();
+
+        kafkaProducer(const kafkaProducer&) = delete;
+        kafkaProducer& operator=(const kafkaProducer&) = delete;
+
+        /// \brief Queue a report for sending. Does not block, unless the topic is sent to for the
+        /// first time and has to be created. Thread-safe.
+        /// \param[in] flowHash Hash of the flow identity selecting the partition.
+        /// \return False if the report was dropped.
+        bool send(const ReportTopic& topic, uint64_t flowHash, std::string_view key, std::string_view report);
+
+        /// \brief Create the topic (if enabled) and its handle ahead of the first report.
+        void prepareTopic(const ReportTopic& topic);
+
+        /// \brief Stop polling and flush outstanding reports. Called by the destructor.
+        void close();
+
+        /// \brief Get a snapshot of the statistics.
+        KafkaStats getStats() const;
+
     private:
-        cppkafka::Configuration kafkaConfig;
+        void onDelivery(const cppkafka::Message& msg);
+        void pollLoop();
+        void replayLoop();
+        bool spoolReport(std::string_view topic, uint64_t flowHash, std::string_view key, std::string_view report);
+        rd_kafka_topic_t* topicHandle(const ReportTopic& topic);
+        void createTopic(const std::string& name);
+        int32_t partitionOf(uint64_t flowHash) const;
+        void printStats() const;
+
+    private:
+        KafkaConfig config;
         cppkafka::Producer kafkaProd;
+
+        std::thread pollThread;
+        std::atomic<bool> stopPolling = false;
+
+        // Topic handles by destination AS and node ID or postcards
+        struct TopicKey
+        {
+            uint64_t dstIsdAs;
+            uint32_t nodeId;
+            bool postcards;
+            bool operator==(const TopicKey&) const = default;
+        };
+        struct TopicKeyHash
+        {
+            size_t operator()(const TopicKey& key) const
+            {
+                return std::hash<uint64_t>()(key.dstIsdAs ^ (uint64_t(key.nodeId) << 48)
+                    ^ (uint64_t(key.postcards) << 47));
+            }
+        };
+        std::shared_mutex topicMutex;
+        std::unordered_map<TopicKey, rd_kafka_topic_t*, TopicKeyHash> topics;
+
+        std::unique_ptr<ReportSpool> spool;
+        std::thread replayThread;
+        std::atomic<bool> brokerUp = true;
+
+        std::atomic<uint64_t> queued = 0;
+        std::atomic<uint64_t> delivered = 0;
+        std::atomic<uint64_t> failed = 0;
+        std::atomic<uint64_t> spooled = 0;
+        std::atomic<uint64_t> replayed = 0;
+        std::atomic<uint64_t> droppedQueueFull = 0;
+        std::atomic<uint64_t> droppedError = 0;
+        std::atomic<uint64_t> latencySumUs = 0;
+        std::atomic<uint64_t> latencyMaxUs = 0;
 };
@@ -1,14 +1,55 @@
 #pragma once
 
 #include "addressConversion.h"
+#include "commonInt.h"
 
+#include <cstdint>
+#include <cstdlib>
 #include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
 #include <vector>
 
+/// \brief Parse the sampling of a destination in the form "<mode>/<N>", e.g., "flow/16".
+/// \exception std::runtime_error if the string is not a valid sampling.
+static IntSampling parseIntSampling(const std::string& str)
+{
+    auto pos = str.find('/');
+    auto mode = str.substr(0, pos);
+    IntSampling sampling;
+    if (mode == "flow")
+        sampling.mode = IntSampleMode::Flow;
+    else if (mode == "random")
+        sampling.mode = IntSampleMode::Random;
+    else if (mode == "first")
+        sampling.mode = IntSampleMode::First;
+    else if (mode != "all" || pos != std::string::npos)
+        throw std::runtime_error("ERROR: Invalid INT sampling \"" + str + "\"");
+
+    if (sampling.mode != IntSampleMode::All)
+    {
+        char* end = nullptr;
+        auto rate = pos == std::string::npos ? 0 : std::strtoul(str.c_str() + pos + 1, &end, 10);
+        if (rate == 0 || rate > UINT16_MAX || *end != '\0')
+            throw std::runtime_error("ERROR: Invalid INT sampling \"" + str + "\"");
+        sampling.rate = static_cast<uint16_t>(rate);
+    }
+    return sampling;
+}
+
+/// \brief Read the INT configuration of the destination ASes.
+/// \details Every line holds a destination AS, the INT and SCION instruction bitmaps and
+/// optionally the mode and the sampling. Mode "md" (default) adds the metadata to the packet, "mx"
+/// reports it in postcards. The sampling selects the packets INT is added to: "all" (default),
+/// "flow/N" for 1 in N flows, "random/N" for 1 in N packets or "first/N" for the first N packets of
+/// every flow.
 static void readIntTable(std::string& intTablePath,
                   std::vector<uint64_t>& asList,
                   std::vector<uint16_t>& bitmaskIntList,
-                  std::vector<uint16_t>& bitmaskScionList)
+                  std::vector<uint16_t>& bitmaskScionList,
+                  std::vector<bool>& postcardList,
+                  std::vector<IntSampling>& samplingList)
 {
     // Get table with bitmasks from file
     std::ifstream intTable;
@@ -30,6 +71,16 @@ static void readIntTable(std::string& intTablePath,
             uint16_t bitmaskInt = 0;
             uint16_t bitmaskScion = 0;
             lineStr >> asName >> std::hex >> bitmaskInt >> bitmaskScion;
+            bool postcard = false;
+            IntSampling sampling;
+            std::string option;
+            while (lineStr >> option)
+            {
+                if (option == "md" || option == "mx")
+                    postcard = option == "mx";
+                else
+                    sampling = parseIntSampling(option);
+            }
             uint16_t isdAddr = 0;
             uint64_t asAddr = 0;
             splitScionAddress(asName, isdAddr, asAddr);
@@ -37,6 +88,8 @@ static void readIntTable(std::string& intTablePath,
             asList.push_back(asAddr);
             bitmaskIntList.push_back(bitmaskInt);
             bitmaskScionList.push_back(bitmaskScion);
+            postcardList.push_back(postcard);
+            samplingList.push_back(sampling);
         }
     }
    
@@ -0,0 +1,332 @@
+#pragma once
+
+#include "intDecoder.h"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+
+// Field numbers and enum values from report/report.proto
+namespace report_wire {
+
+// Wire types
+constexpr uint8_t VARINT = 0;
+constexpr uint8_t LEN = 2;
+
+constexpr uint8_t tag(uint32_t field, uint8_t wireType)
+{
+    return static_cast<uint8_t>((field << 3) | wireType);
+}
+
+// Report
+constexpr uint8_t REPORT_HOPS = tag(1, LEN);
+constexpr uint8_t REPORT_PACKET_TYPE = tag(2, VARINT);
+constexpr uint8_t REPORT_TRUNCATED_PACKET = tag(3, LEN);
+constexpr uint8_t REPORT_POSTCARD = tag(4, VARINT);
+constexpr uint8_t REPORT_SEQUENCE = tag(5, VARINT);
+constexpr uint32_t PACKET_TYPE_SCION = 4;
+
+// Hop
+constexpr uint8_t HOP_ASN = tag(1, VARINT);
+constexpr uint8_t HOP_NODE_ID = tag(2, VARINT);
+constexpr uint8_t HOP_METADATA = tag(3, LEN);
+constexpr uint8_t MAP_KEY = tag(1, VARINT);
+constexpr uint8_t MAP_VALUE = tag(2, LEN);
+
+// FlowKey
+constexpr uint8_t FIXED64 = 1;
+constexpr uint8_t FIXED32 = 5;
+constexpr uint8_t FLOW_KEY_DST_AS = tag(1, VARINT);
+constexpr uint8_t FLOW_KEY_SRC_AS = tag(2, VARINT);
+constexpr uint8_t FLOW_KEY_FLOW_ID = tag(3, VARINT);
+constexpr uint8_t FLOW_KEY_DST_IPV4 = tag(4, FIXED32);
+constexpr uint8_t FLOW_KEY_DST_IPV6 = tag(5, LEN);
+constexpr uint8_t FLOW_KEY_SRC_IPV4 = tag(6, FIXED32);
+constexpr uint8_t FLOW_KEY_SRC_IPV6 = tag(7, LEN);
+constexpr uint8_t FLOW_KEY_DST_PORT = tag(8, VARINT);
+constexpr uint8_t FLOW_KEY_SRC_PORT = tag(9, VARINT);
+constexpr uint8_t FLOW_KEY_PROTOCOL = tag(10, VARINT);
+constexpr uint8_t IPV6_HIGH = tag(1, FIXED64);
+constexpr uint8_t IPV6_LOW = tag(2, FIXED64);
+constexpr uint8_t IPV6_ADDRESS_BYTES = 18;
+
+// FlowKey.Protocol
+constexpr uint32_t PROTOCOL_UDP = 1;
+constexpr uint32_t PROTOCOL_TCP = 2;
+
+// SCION next header values
+constexpr uint8_t NEXT_HDR_TCP = 0x06;
+constexpr uint8_t NEXT_HDR_UDP = 0x11;
+
+// MetadataType of each INT field, 0 for fields that are not stored in the metadata map
+constexpr std::array<uint8_t, INT_FIELD_COUNT> METADATA_TYPE = {
+    0, // NODE_ID -> Hop.node_id
+    1, // INTERFACE_LEVEL1
+    2, // HOP_LATENCY
+    3, // QUEUE_OCCUPANCY
+    4, // INGRESS_TIMESTAMP
+    5, // EGRESS_TIMESTAMP
+    6, // INTERFACE_LEVEL2
+    7, // EGRESS_TX_UTILIZATION
+    8, // BUFFER_OCCUPANCY
+    0, // AS_ADDR -> Hop.asn
+};
+
+constexpr size_t varintSize(uint64_t value)
+{
+    size_t size = 1;
+    while (value >= 0x80)
+    {
+        value >>= 7;
+        ++size;
+    }
+    return size;
+}
+
+inline char* writeVarint(char* p, uint64_t value)
+{
+    while (value >= 0x80)
+    {
+        *p++ = static_cast<char>(value | 0x80);
+        value >>= 7;
+    }
+    *p++ = static_cast<char>(value);
+    return p;
+}
+
+/// \brief Write a fixed-size integer in the little-endian byte order of the protobuf wire format.
+template <typename T>
+inline char* writeFixed(char* p, T value)
+{
+    for (size_t i = 0; i < sizeof(T); ++i, value >>= 8)
+        *p++ = static_cast<char>(value & 0xff);
+    return p;
+}
+
+} // namespace report_wire
+
+
+/// \brief Serializes decoded INT stacks into the protobuf wire format of telemetry.report.Report
+/// without building intermediate message objects.
+///
+/// The output is identical to the deterministic serialization of the equivalent Report message
+/// (fields in ascending order, map entries sorted by key), so it can be parsed by any protobuf
+/// implementation. Output buffers are reused between calls.
+class ReportEncoder
+{
+public:
+    /// Maximum number of serialized flow keys kept in the cache.
+    static constexpr size_t MAX_CACHED_FLOW_KEYS = 1 << 16;
+
+    /// \brief Encode a report.
+    /// \details Timestamps are converted from microseconds to nanoseconds.
+    /// \return View of the serialized report. Valid until the next call to encode().
+    std::string_view encode(const IntReport& report)
+    {
+        using namespace report_wire;
+        const auto& layout = *report.layout;
+
+        // Size of the metadata map entries, identical for all hops
+        size_t metadataSize = 0;
+        for (unsigned f = 0; f < INT_FIELD_COUNT; ++f)
+        {
+            if (METADATA_TYPE[f] && layout.has(static_cast<IntField>(f)))
+                metadataSize += 2 + mapEntrySize(INT_FIELD_BYTES[f]);
+        }
+
+        // Compute sizes before writing, since lengths precede the length-delimited fields
+        size_t total = 0;
+        hopSizes.resize(report.hops.size());
+        for (size_t i = 0; i < report.hops.size(); ++i)
+        {
+            const auto& hop = report.hops[i];
+            size_t size = metadataSize;
+            if (layout.has(INT_FIELD_AS_ADDR) && hop.asAddr)
+                size += 1 + varintSize(hop.asAddr);
+            if (layout.has(INT_FIELD_NODE_ID) && hop.nodeId)
+                size += 1 + varintSize(hop.nodeId);
+            hopSizes[i] = size;
+            total += 1 + varintSize(size) + size;
+        }
+        total += 1 + varintSize(PACKET_TYPE_SCION);
+        if (!report.headers.empty())
+            total += 1 + varintSize(report.headers.size()) + report.headers.size();
+        if (report.postcard)
+            total += 2 + (report.sequence ? 1 + varintSize(report.sequence) : 0);
+
+        reportBuffer.resize(total);
+        char* p = reportBuffer.data();
+        for (size_t i = 0; i < report.hops.size(); ++i)
+        {
+            const auto& hop = report.hops[i];
+            *p++ = REPORT_HOPS;
+            p = writeVarint(p, hopSizes[i]);
+            if (layout.has(INT_FIELD_AS_ADDR) && hop.asAddr)
+            {
+                *p++ = HOP_ASN;
+                p = writeVarint(p, hop.asAddr);
+            }
+            if (layout.has(INT_FIELD_NODE_ID) && hop.nodeId)
+            {
+                *p++ = HOP_NODE_ID;
+                p = writeVarint(p, hop.nodeId);
+            }
+            if (layout.has(INT_FIELD_L1_IF_ID))
+                p = writeMetadata<uint32_t>(p, INT_FIELD_L1_IF_ID, hop.l1IfId);
+            if (layout.has(INT_FIELD_HOP_LATENCY))
+                p = writeMetadata<uint32_t>(p, INT_FIELD_HOP_LATENCY, hop.hopLatency);
+            if (layout.has(INT_FIELD_QUEUE))
+                p = writeMetadata<uint32_t>(p, INT_FIELD_QUEUE, hop.queue);
+            if (layout.has(INT_FIELD_INGRESS_TIME))
+                p = writeMetadata<uint64_t>(p, INT_FIELD_INGRESS_TIME, hop.ingressTime * 1000);
+            if (layout.has(INT_FIELD_EGRESS_TIME))
+                p = writeMetadata<uint64_t>(p, INT_FIELD_EGRESS_TIME, hop.egressTime * 1000);
+            if (layout.has(INT_FIELD_L2_IF_ID))
+                p = writeMetadata<uint64_t>(p, INT_FIELD_L2_IF_ID, hop.l2IfId);
+            if (layout.has(INT_FIELD_EG_IF_UTIL))
+                p = writeMetadata<uint32_t>(p, INT_FIELD_EG_IF_UTIL, hop.egIfUtil);
+            if (layout.has(INT_FIELD_BUFFER_INFOS))
+                p = writeMetadata<uint32_t>(p, INT_FIELD_BUFFER_INFOS, hop.bufferInfos);
+        }
+        *p++ = REPORT_PACKET_TYPE;
+        p = writeVarint(p, PACKET_TYPE_SCION);
+        if (!report.headers.empty())
+        {
+            *p++ = REPORT_TRUNCATED_PACKET;
+            p = writeVarint(p, report.headers.size());
+            std::memcpy(p, report.headers.data(), report.headers.size());
+            p += report.headers.size();
+        }
+        if (report.postcard)
+        {
+            *p++ = REPORT_POSTCARD;
+            *p++ = 1;
+            if (report.sequence)
+            {
+                *p++ = REPORT_SEQUENCE;
+                p = writeVarint(p, report.sequence);
+            }
+        }
+
+        return reportBuffer;
+    }
+
+    /// \brief Get the serialized telemetry.report.FlowKey for a flow.
+    /// \details Host addresses are only included if they are specified IPv4 or IPv6 addresses.
+    /// \return View of the cached key. Valid until the next call to flowKey().
+    std::string_view flowKey(const FlowIdentity& flow)
+    {
+        auto i = flowKeys.find(flow);
+        if (i != flowKeys.end())
+            return i->second;
+
+        if (flowKeys.size() >= MAX_CACHED_FLOW_KEYS)
+            flowKeys.clear();
+
+        return flowKeys.emplace(flow, encodeFlowKey(flow)).first->second;
+    }
+
+    /// \brief Serialize a telemetry.report.FlowKey without caching it.
+    static std::string encodeFlowKey(const FlowIdentity& flow)
+    {
+        using namespace report_wire;
+        constexpr uint64_t AS_MASK = 0xffffffffffffull;
+
+        // Large enough for all fields at their maximum size
+        char buffer[128];
+        char* p = buffer;
+        if (flow.dstIsdAs & AS_MASK)
+        {
+            *p++ = FLOW_KEY_DST_AS;
+            p = writeVarint(p, flow.dstIsdAs & AS_MASK);
+        }
+        if (flow.srcIsdAs & AS_MASK)
+        {
+            *p++ = FLOW_KEY_SRC_AS;
+            p = writeVarint(p, flow.srcIsdAs & AS_MASK);
+        }
+        if (flow.flowId)
+        {
+            *p++ = FLOW_KEY_FLOW_ID;
+            p = writeVarint(p, flow.flowId);
+        }
+        p = writeHost(p, flow.dstHostType, flow.dstHost, FLOW_KEY_DST_IPV4, FLOW_KEY_DST_IPV6);
+        p = writeHost(p, flow.srcHostType, flow.srcHost, FLOW_KEY_SRC_IPV4, FLOW_KEY_SRC_IPV6);
+        if (flow.dstPort)
+        {
+            *p++ = FLOW_KEY_DST_PORT;
+            p = writeVarint(p, flow.dstPort);
+        }
+        if (flow.srcPort)
+        {
+            *p++ = FLOW_KEY_SRC_PORT;
+            p = writeVarint(p, flow.srcPort);
+        }
+        uint32_t protocol = flow.protocol == NEXT_HDR_UDP ? PROTOCOL_UDP
+            : flow.protocol == NEXT_HDR_TCP ? PROTOCOL_TCP : 0;
+        if (protocol)
+        {
+            *p++ = FLOW_KEY_PROTOCOL;
+            p = writeVarint(p, protocol);
+        }
+        return std::string(buffer, p);
+    }
+
+private:
+    static constexpr size_t mapEntrySize(size_t valueBytes)
+    {
+        // key tag + key (types are < 128) + value tag + value length + value
+        return 4 + valueBytes;
+    }
+
+    /// \brief Write a host address as one of the members of the dst_ip or src_ip oneof.
+    static char* writeHost(char* p, uint8_t hostType, const std::array<std::byte, 16>& host,
+        uint8_t ipv4Tag, uint8_t ipv6Tag)
+    {
+        using namespace report_wire;
+        // The unspecified address does not identify anything
+        if (std::all_of(host.begin(), host.end(), [](std::byte b) { return b == std::byte{0}; }))
+            return p;
+        if (FlowIdentity::isIpv4(hostType))
+        {
+            *p++ = ipv4Tag;
+            p = writeFixed(p, loadBigEndian<uint32_t>(host.data()));
+        }
+        else if (FlowIdentity::isIpv6(hostType))
+        {
+            *p++ = ipv6Tag;
+            *p++ = IPV6_ADDRESS_BYTES;
+            *p++ = IPV6_HIGH;
+            p = writeFixed(p, loadBigEndian<uint64_t>(host.data()));
+            *p++ = IPV6_LOW;
+            p = writeFixed(p, loadBigEndian<uint64_t>(host.data() + 8));
+        }
+        return p;
+    }
+
+    template <typename T>
+    static char* writeMetadata(char* p, IntField field, T value)
+    {
+        using namespace report_wire;
+        *p++ = HOP_METADATA;
+        *p++ = static_cast<char>(mapEntrySize(sizeof(T)));
+        *p++ = MAP_KEY;
+        *p++ = static_cast<char>(METADATA_TYPE[field]);
+        *p++ = MAP_VALUE;
+        *p++ = static_cast<char>(sizeof(T));
+        storeBigEndian<T>(p, value);
+        return p + sizeof(T);
+    }
+
+private:
+    std::string reportBuffer;
+    std::vector<size_t> hopSizes;
+    std::unordered_map<FlowIdentity, std::string, FlowIdentityHash> flowKeys;
+};
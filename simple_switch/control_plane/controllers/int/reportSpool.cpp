@@ -0,0 +1,327 @@
+#include "reportSpool.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <charconv>
+#include <cstring>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+
+// Segment layout (host byte order, segments are not meant to be moved between machines):
+//   Header: magic (4 bytes), version (4 bytes), read offset (8 bytes)
+//   Records: record length excluding this field (4 bytes), checksum (4 bytes), topic length
+//            (4 bytes), key length (4 bytes), flow hash (8 bytes), topic, key, report
+// Segments are zero-filled when created, a record length of zero marks the end of the data. The
+// length is written last, so a record interrupted by a crash has a length of zero. The checksum
+// covers everything after it and catches records torn by writeback of a crashed system.
+constexpr uint32_t SEGMENT_MAGIC = 0x4c505349; // "ISPL"
+constexpr uint32_t SEGMENT_VERSION = 3;
+constexpr size_t SEGMENT_HEADER_BYTES = 16;
+constexpr size_t READ_OFFSET_POS = 8;
+constexpr size_t RECORD_HEADER_BYTES = 24;
+constexpr size_t RECORD_CHECKSUM_POS = 4;
+
+static const char* SEGMENT_PREFIX = "spool-";
+static const char* SEGMENT_SUFFIX = ".seg";
+
+template <typename T>
+static T loadHost(const char* src)
+{
+    T value;
+    std::memcpy(&value, src, sizeof(T));
+    return value;
+}
+
+template <typename T>
+static void storeHost(char* dst, T value)
+{
+    std::memcpy(dst, &value, sizeof(T));
+}
+
+/// \brief FNV-1a hash of a record, excluding its length and checksum fields.
+static uint32_t recordChecksum(const char* record, size_t length)
+{
+    uint32_t hash = 0x811c9dc5;
+    const char* end = record + sizeof(uint32_t) + length;
+    for (const char* p = record + RECORD_CHECKSUM_POS + sizeof(uint32_t); p < end; ++p)
+    {
+        hash ^= static_cast<uint8_t>(*p);
+        hash *= 0x01000193;
+    }
+    return hash;
+}
+
+/// \brief Parse the sequence number from the name of a segment file.
+/// \return False if the name is not the name of a segment.
+static bool parseSegmentName(const std::string& name, uint64_t& seq)
+{
+    if (!name.starts_with(SEGMENT_PREFIX) || !name.ends_with(SEGMENT_SUFFIX))
+        return false;
+    const char* first = name.data() + std::strlen(SEGMENT_PREFIX);
+    const char* last = name.data() + name.size() - std::strlen(SEGMENT_SUFFIX);
+    if (first >= last)
+        return false;
+    auto [end, ec] = std::from_chars(first, last, seq);
+    return ec == std::errc() && end == last;
+}
+
+static std::runtime_error spoolError(const std::string& what, const std::string& path)
+{
+    return std::runtime_error("Spool: " + what + " " + path + ": " + std::strerror(errno));
+}
+
+
+ReportSpool::ReportSpool(const SpoolConfig& config_)
+    : config(config_)
+{
+    if (config.segmentBytes <= SEGMENT_HEADER_BYTES + RECORD_HEADER_BYTES)
+        throw std::runtime_error("Spool: Segment size too small");
+    std::filesystem::create_directories(config.directory);
+
+    // Pick up segments of a previous run in order of their sequence numbers
+    std::vector<uint64_t> seqs;
+    for (const auto& entry : std::filesystem::directory_iterator(config.directory))
+    {
+        auto name = entry.path().filename().string();
+        uint64_t seq = 0;
+        if (parseSegmentName(name, seq))
+            seqs.push_back(seq);
+        else if (name.starts_with(SEGMENT_PREFIX))
+            std::cout << "Spool: Ignoring " << entry.path().string() << std::endl;
+    }
+    std::sort(seqs.begin(), seqs.end());
+
+    uint64_t pending = 0;
+    for (auto seq : seqs)
+    {
+        auto segment = openSegment(seq, false);
+        if (!segment.base)
+            continue;
+
+        // Find the end of the data and count the unread records. Records following a torn record
+        // are lost, nothing is appended to the segment after it.
+        size_t readOffset = loadHost<uint64_t>(segment.base + READ_OFFSET_POS);
+        size_t offset = SEGMENT_HEADER_BYTES;
+        while (offset + RECORD_HEADER_BYTES <= segment.size)
+        {
+            const char* record = segment.base + offset;
+            size_t length = loadHost<uint32_t>(record);
+            if (!length)
+                break;
+            if (length + sizeof(uint32_t) < RECORD_HEADER_BYTES
+                || offset + sizeof(uint32_t) + length > segment.size
+                || loadHost<uint32_t>(record + RECORD_CHECKSUM_POS) != recordChecksum(record, length)
+                || 0ull + loadHost<uint32_t>(record + 8) + loadHost<uint32_t>(record + 12)
+                    > length + sizeof(uint32_t) - RECORD_HEADER_BYTES)
+            {
+                // Clear the rest of the segment, so it can be appended to again
+                std::cout << "Spool: Dropping torn record in " << segment.path << std::endl;
+                std::memset(segment.base + offset, 0, segment.size - offset);
+                break;
+            }
+            if (offset >= readOffset)
+                ++pending;
+            offset += sizeof(uint32_t) + length;
+        }
+        segment.writeOffset = offset;
+        segments.push_back(std::move(segment));
+        nextSeq = seq + 1;
+    }
+    appended = pending;
+
+    if (pending)
+        std::cout << "Spool: " << std::dec << pending << " reports pending in " << config.directory << std::endl;
+}
+
+ReportSpool::~ReportSpool()
+{
+    for (auto& segment : segments)
+        closeSegment(segment, false);
+}
+
+bool ReportSpool::append(std::string_view topic, uint64_t flowHash, std::string_view key, std::string_view report)
+{
+    size_t bytes = RECORD_HEADER_BYTES + topic.size() + key.size() + report.size();
+    if (bytes > config.segmentBytes - SEGMENT_HEADER_BYTES)
+    {
+        dropped.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    if (segments.empty() || segments.back().writeOffset + bytes > segments.back().size)
+    {
+        if (!addSegment())
+        {
+            dropped.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+    }
+
+    auto& segment = segments.back();
+    char* record = segment.base + segment.writeOffset;
+    uint32_t length = static_cast<uint32_t>(bytes - sizeof(uint32_t));
+    storeHost<uint32_t>(record + 8, static_cast<uint32_t>(topic.size()));
+    storeHost<uint32_t>(record + 12, static_cast<uint32_t>(key.size()));
+    storeHost<uint64_t>(record + 16, flowHash);
+    char* p = record + RECORD_HEADER_BYTES;
+    p = std::copy(topic.begin(), topic.end(), p);
+    p = std::copy(key.begin(), key.end(), p);
+    std::copy(report.begin(), report.end(), p);
+    storeHost<uint32_t>(record + RECORD_CHECKSUM_POS, recordChecksum(record, length));
+
+    // Publish the record by writing its length last
+    std::atomic_thread_fence(std::memory_order_release);
+    storeHost<uint32_t>(record, length);
+    segment.writeOffset += bytes;
+
+    appended.fetch_add(1, std::memory_order_release);
+    return true;
+}
+
+bool ReportSpool::front(SpoolRecord& record)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    while (!segments.empty())
+    {
+        auto& segment = segments.front();
+        size_t readOffset = loadHost<uint64_t>(segment.base + READ_OFFSET_POS);
+        if (readOffset < segment.writeOffset)
+        {
+            const char* p = segment.base + readOffset;
+            size_t topicSize = loadHost<uint32_t>(p + 8);
+            size_t keySize = loadHost<uint32_t>(p + 12);
+            record.flowHash = loadHost<uint64_t>(p + 16);
+            size_t length = loadHost<uint32_t>(p);
+            p += RECORD_HEADER_BYTES;
+            record.topic = std::string_view(p, topicSize);
+            record.key = std::string_view(p + topicSize, keySize);
+            record.report = std::string_view(p + topicSize + keySize,
+                length + sizeof(uint32_t) - RECORD_HEADER_BYTES - topicSize - keySize);
+            frontBytes = sizeof(uint32_t) + length;
+            return true;
+        }
+
+        // Keep the segment currently written to
+        if (segments.size() == 1)
+            return false;
+        closeSegment(segment, true);
+        segments.pop_front();
+    }
+    return false;
+}
+
+void ReportSpool::pop()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    if (segments.empty() || !frontBytes)
+        return;
+
+    auto& segment = segments.front();
+    size_t readOffset = loadHost<uint64_t>(segment.base + READ_OFFSET_POS);
+    storeHost<uint64_t>(segment.base + READ_OFFSET_POS, readOffset + frontBytes);
+    frontBytes = 0;
+    popped.fetch_add(1, std::memory_order_release);
+}
+
+/// \brief Append a new segment if the size cap permits. Called with the mutex held.
+bool ReportSpool::addSegment()
+{
+    if ((segments.size() + 1) * config.segmentBytes > config.maxBytes)
+        return false;
+
+    // Start writing back the full segment, it will not change anymore
+    if (!segments.empty())
+        msync(segments.back().base, segments.back().size, MS_ASYNC);
+
+    try {
+        segments.push_back(openSegment(nextSeq, true));
+    }
+    catch (std::runtime_error& e) {
+        std::cout << e.what() << std::endl;
+        return false;
+    }
+    ++nextSeq;
+    return true;
+}
+
+std::string ReportSpool::segmentPath(uint64_t seq) const
+{
+    std::stringstream name;
+    name << SEGMENT_PREFIX << std::dec << std::setw(20) << std::setfill('0') << seq << SEGMENT_SUFFIX;
+    return (std::filesystem::path(config.directory) / name.str()).string();
+}
+
+/// \brief Open and map a segment file.
+/// \param[in] create Create a new, empty segment. Otherwise an existing one is opened.
+/// \return Segment with a null base pointer if an existing file is not a valid segment.
+ReportSpool::Segment ReportSpool::openSegment(uint64_t seq, bool create)
+{
+    Segment segment{seq, segmentPath(seq), -1, nullptr, 0, SEGMENT_HEADER_BYTES};
+
+    segment.fd = ::open(segment.path.c_str(), create ? (O_RDWR | O_CREAT | O_EXCL) : O_RDWR, 0644);
+    if (segment.fd < 0)
+        throw spoolError("Cannot open", segment.path);
+    if (create && ::ftruncate(segment.fd, config.segmentBytes) < 0)
+    {
+        ::close(segment.fd);
+        throw spoolError("Cannot allocate", segment.path);
+    }
+
+    struct stat st;
+    if (::fstat(segment.fd, &st) < 0 || static_cast<size_t>(st.st_size) < SEGMENT_HEADER_BYTES)
+    {
+        std::cout << "Spool: Ignoring invalid segment " << segment.path << std::endl;
+        ::close(segment.fd);
+        segment.fd = -1;
+        return segment;
+    }
+    segment.size = st.st_size;
+
+    void* base = ::mmap(nullptr, segment.size, PROT_READ | PROT_WRITE, MAP_SHARED, segment.fd, 0);
+    if (base == MAP_FAILED)
+    {
+        ::close(segment.fd);
+        throw spoolError("Cannot map", segment.path);
+    }
+    segment.base = static_cast<char*>(base);
+
+    if (create)
+    {
+        storeHost<uint32_t>(segment.base, SEGMENT_MAGIC);
+        storeHost<uint32_t>(segment.base + 4, SEGMENT_VERSION);
+        storeHost<uint64_t>(segment.base + READ_OFFSET_POS, SEGMENT_HEADER_BYTES);
+    }
+    else if (loadHost<uint32_t>(segment.base) != SEGMENT_MAGIC
+        || loadHost<uint32_t>(segment.base + 4) != SEGMENT_VERSION
+        || loadHost<uint64_t>(segment.base + READ_OFFSET_POS) < SEGMENT_HEADER_BYTES)
+    {
+        std::cout << "Spool: Ignoring invalid segment " << segment.path << std::endl;
+        closeSegment(segment, false);
+    }
+    return segment;
+}
+
+/// \brief Unmap a segment and optionally delete its file.
+void ReportSpool::closeSegment(Segment& segment, bool remove)
+{
+    if (segment.base)
+        ::munmap(segment.base, segment.size);
+    if (segment.fd >= 0)
+        ::close(segment.fd);
+    if (remove)
+        ::unlink(segment.path.c_str());
+    segment.base = nullptr;
+    segment.fd = -1;
+}
@@ -0,0 +1,97 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <string_view>
+
+
+/// \brief Settings of the report spool.
+struct SpoolConfig
+{
+    /// Directory holding the segment files. Created if it does not exist.
+    std::string directory;
+    /// Size of a segment file in bytes.
+    size_t segmentBytes = 64 << 20;
+    /// Maximum total size of all segment files in bytes. Further reports are dropped.
+    size_t maxBytes = size_t(1) << 30;
+};
+
+/// \brief A report read back from the spool.
+/// \details Views into the memory-mapped segment, valid until ReportSpool::pop() is called.
+struct SpoolRecord
+{
+    std::string_view topic;
+    uint64_t flowHash;
+    std::string_view key;
+    std::string_view report;
+};
+
+/// \brief Durable FIFO of serialized reports backed by memory-mapped, append-only segment files.
+///
+/// Records are appended to the newest segment. When it is full a new segment is created, as long
+/// as the total size stays below the configured cap. Every segment stores how far it has been read
+/// in its header, so reports spooled before a restart of the controller are replayed afterwards.
+/// Segments are deleted as soon as they have been read completely. Records are checksummed and
+/// published by writing their length last, so records torn by a crash are dropped on recovery.
+///
+/// Any number of threads may append concurrently, but only one thread may call front() and pop().
+class ReportSpool
+{
+public:
+    /// \brief Open the spool, picking up segments left by a previous run.
+    /// \exception std::runtime_error if the directory or a segment cannot be opened.
+    explicit ReportSpool(const SpoolConfig& config);
+    ~ReportSpool();
+
+    ReportSpool(const ReportSpool&) = delete;
+    ReportSpool& operator=(const ReportSpool&) = delete;
+
+    /// \brief Append a report.
+    /// \return False if the spool is full or the report is larger than a segment.
+    bool append(std::string_view topic, uint64_t flowHash, std::string_view key, std::string_view report);
+
+    /// \brief Get the oldest report without removing it.
+    /// \return False if the spool is empty.
+    bool front(SpoolRecord& record);
+
+    /// \brief Remove the report returned by the last call to front().
+    void pop();
+
+    /// \brief Number of reports that have been appended but not popped yet.
+    uint64_t size() const { return appended - popped; }
+    bool empty() const { return size() == 0; }
+
+    /// Reports dropped because the spool was full.
+    uint64_t getDropped() const { return dropped; }
+
+private:
+    struct Segment
+    {
+        uint64_t seq;
+        std::string path;
+        int fd;
+        char* base;
+        size_t size;
+        size_t writeOffset;
+    };
+
+    Segment openSegment(uint64_t seq, bool create);
+    void closeSegment(Segment& segment, bool remove);
+    bool addSegment();
+    std::string segmentPath(uint64_t seq) const;
+
+private:
+    const SpoolConfig config;
+    mutable std::mutex mutex;
+    std::deque<Segment> segments;
+    uint64_t nextSeq = 0;
+    size_t frontBytes = 0; // Size of the record returned by front()
+
+    std::atomic<uint64_t> appended = 0;
+    std::atomic<uint64_t> popped = 0;
+    std::atomic<uint64_t> dropped = 0;
+};
@@ -1,36 +1,61 @@
 #pragma once
 
+#include <bit>
+#include <cstdint>
+#include <cstring>
+
+/// \brief Load an unsigned integer stored in big-endian byte order from an unaligned location.
+/// \details Compiles to a plain load followed by a single byte swap instruction on little-endian
+/// hosts.
+template <typename T>
+static inline T loadBigEndian(const void* src)
+{
+    T value;
+    std::memcpy(&value, src, sizeof(T));
+    if constexpr (std::endian::native == std::endian::little)
+    {
+        if constexpr (sizeof(T) == 8)
+            value = static_cast<T>(__builtin_bswap64(value));
+        else if constexpr (sizeof(T) == 4)
+            value = static_cast<T>(__builtin_bswap32(value));
+        else if constexpr (sizeof(T) == 2)
+            value = static_cast<T>(__builtin_bswap16(value));
+    }
+    return value;
+}
+
+/// \brief Store an unsigned integer in big-endian byte order to an unaligned location.
+template <typename T>
+static inline void storeBigEndian(void* dst, T value)
+{
+    if constexpr (std::endian::native == std::endian::little)
+    {
+        if constexpr (sizeof(T) == 8)
+            value = static_cast<T>(__builtin_bswap64(value));
+        else if constexpr (sizeof(T) == 4)
+            value = static_cast<T>(__builtin_bswap32(value));
+        else if constexpr (sizeof(T) == 2)
+            value = static_cast<T>(__builtin_bswap16(value));
+    }
+    std::memcpy(dst, &value, sizeof(T));
+}
+
 static uint64_t takeUint64(const char* payload, uint32_t pos)
 {
         // Data is transferred in big-endian format, but saved in little-endian format
-        uint64_t number;
-        for (int i = 0; i < 8; i ++)
-        {
-            *(reinterpret_cast<char*>(&number) + i) = *(payload + pos + 7 - i);
-        }
-        return number;
+        return loadBigEndian<uint64_t>(payload + pos);
 }
 
 static uint32_t takeUint32(const char* payload, uint32_t pos)
 {
         // Data is transferred in big-endian format, but saved in little-endian format
-        uint32_t number;
-        for (int i = 0; i < 4; i ++)
-        {
-            *(reinterpret_cast<char*>(&number) + i) = *(payload + pos + 3 - i);
-        }
-        return number;
+        return loadBigEndian<uint32_t>(payload + pos);
 }
 
 static uint16_t takeUint16(const char* payload, uint32_t pos)
 {
         // Data is transferred in big-endian format, but saved in little-endian format
-        uint16_t number;
-        for (int i = 0; i < 2; i ++)
-        {
-            *(reinterpret_cast<char*>(&number) + i) = *(payload + pos + 1 - i);
-        }
-        return number;
+        return loadBigEndian<uint16_t>(payload + pos);
 }
 
 static uint8_t takeUint8(const char* payload, uint32_t pos)
@@ -1,29 +1,56 @@
 #include "tcpClient.h"
+#include "takeUint.h"
 
 #include <boost/asio.hpp>
+#include <algorithm>
 #include <iostream>
 
 
 using boost::asio::ip::tcp;
 
+// Size of the frame header preceding every report
+constexpr size_t FRAME_HEADER_BYTES = sizeof(uint32_t);
+
 // Create TCP client object
-tcpClient::tcpClient() : isActive(false)
+tcpClient::tcpClient(const TcpConfig& config_)
+    : config(config_)
+    , tcpSocket(ioContext)
+    , reconnectTimer(ioContext)
+    , backoff(config_.minBackoff)
+    , isActive(false)
+    , wasConnected(false)
+    , queuedBytes(0)
+    , writing(false)
 {}
 
-// Create a TCP client and instantiate a connection
+tcpClient::~tcpClient()
+{
+    close();
+}
+
+// Stop the I/O thread, reports still queued are discarded
+void tcpClient::close()
+{
+    if (ioThread.joinable())
+    {
+        work.reset();
+        ioContext.stop();
+        ioThread.join();
+        isActive = false;
+    }
+}
+
+// Start the I/O thread and connect to the server
 bool tcpClient::createClient(const tcp::endpoint& ep)
 {
-    boost::asio::io_context io_context;
-    boost::system::error_code err;
-    
-    tcpSocket = std::make_unique<tcp::socket>(io_context);
-    tcpSocket->connect(ep, err);
-    // Check, if the connection could be established
-    if (err)
-        std::cout << "Error: Could not connect to TCP server: " << err.message() << std::endl << "TCP server is not used." << std::endl;
-    else
-        isActive = true;
-    return isActive;
+    if (ioThread.joinable())
+        return false;
+
+    endpoint = ep;
+    work.emplace(boost::asio::make_work_guard(ioContext));
+    boost::asio::post(ioContext, [this] { connect(); });
+    ioThread = std::thread([this] { ioContext.run(); });
+    return true;
 }
 
 // Get TCP client state
@@ -32,40 +59,137 @@ bool tcpClient::getIsActive()
     return isActive;
 }
 
-// Send a string
-bool tcpClient::send(const std::string& report)
+TcpStats tcpClient::getStats() const
 {
-    if (isActive)
+    TcpStats stats;
+    stats.sent = sent.load(std::memory_order_relaxed);
+    stats.droppedQueueFull = droppedQueueFull.load(std::memory_order_relaxed);
+    stats.droppedError = droppedError.load(std::memory_order_relaxed);
+    stats.reconnects = reconnects.load(std::memory_order_relaxed);
+    return stats;
+}
+
+// Queue a report
+bool tcpClient::send(std::string_view report)
+{
+    if (!ioThread.joinable())
+        return false;
+
+    // Length prefix in network byte order followed by the report
+    std::string frame(FRAME_HEADER_BYTES + report.size(), '\0');
+    storeBigEndian<uint32_t>(frame.data(), static_cast<uint32_t>(report.size()));
+    std::copy(report.begin(), report.end(), frame.begin() + FRAME_HEADER_BYTES);
+
+    bool startWriting = false;
     {
-        uint32_t len = report.length();
-        write(&len, sizeof(uint32_t));
-        write(report);
+        std::lock_guard<std::mutex> lock(queueMutex);
+        if (queuedBytes + frame.size() > config.maxQueuedBytes)
+        {
+            droppedQueueFull.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        queuedBytes += frame.size();
+        queue.push_back(std::move(frame));
+        if (!writing && isActive)
+            startWriting = writing = true;
     }
-    return isActive;
+    if (startWriting)
+        boost::asio::post(ioContext, [this] { startWrite(); });
+    return true;
 }
 
-// Helper to send const void data
-bool tcpClient::write(const void* data, size_t size)
+// Try to establish a connection to the server
+void tcpClient::connect()
 {
-    if (isActive)
-    {
-        boost::system::error_code err;
-        boost::asio::write(*tcpSocket, boost::asio::buffer(data, size), err);
-        // Error handling if write fails
-        // If error close connection and set inactive
+    tcpSocket.async_connect(endpoint, [this](const boost::system::error_code& err) {
         if (err)
         {
-            std::cout << "TCP Error: " << err.message() << std::endl;
-            tcpSocket->close();
-            isActive = false;
+            std::cout << "Error: Could not connect to TCP server: " << err.message() << std::endl;
+            tcpSocket.close();
+            scheduleReconnect();
+            return;
+        }
+
+        boost::system::error_code ignored;
+        tcpSocket.set_option(tcp::no_delay(true), ignored);
+        backoff = config.minBackoff;
+        if (wasConnected)
+            reconnects.fetch_add(1, std::memory_order_relaxed);
+        wasConnected = true;
+        std::cout << "Connected to TCP server " << endpoint << std::endl;
+
+        // Send everything queued while the connection was down
+        bool startWriting = false;
+        {
+            std::lock_guard<std::mutex> lock(queueMutex);
+            isActive = true;
+            if (!writing && !queue.empty())
+                startWriting = writing = true;
+        }
+        if (startWriting)
+            startWrite();
+    });
+}
+
+// Retry connecting after the current backoff delay
+void tcpClient::scheduleReconnect()
+{
+    std::cout << "Reconnecting to TCP server in " << std::dec << backoff.count() << " ms" << std::endl;
+    reconnectTimer.expires_after(backoff);
+    reconnectTimer.async_wait([this](const boost::system::error_code& err) {
+        if (!err)
+            connect();
+    });
+    backoff = std::min(2 * backoff, config.maxBackoff);
+}
+
+// Write as many queued frames as fit in a batch
+void tcpClient::startWrite()
+{
+    {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        size_t batchBytes = 0;
+        while (!queue.empty() && (inFlight.empty() || batchBytes + queue.front().size() <= config.maxBatchBytes))
+        {
+            batchBytes += queue.front().size();
+            inFlight.push_back(std::move(queue.front()));
+            queue.pop_front();
+        }
+        queuedBytes -= batchBytes;
+        if (inFlight.empty())
+        {
+            writing = false;
+            return;
         }
     }
-    return isActive;
+
+    buffers.clear();
+    for (const auto& frame : inFlight)
+        buffers.push_back(boost::asio::buffer(frame));
+    boost::asio::async_write(tcpSocket, buffers,
+        [this](const boost::system::error_code& err, size_t) { onWrite(err); });
 }
 
-// Helper to send a string
-bool tcpClient::write(const std::string& data)
+// Completion handler of a batch write
+void tcpClient::onWrite(const boost::system::error_code& err)
 {
-    write(data.c_str(), data.length());
-    return isActive;
+    if (err)
+    {
+        // The batch may have been written partially, the server has to resynchronize
+        std::cout << "TCP Error: " << err.message() << std::endl;
+        droppedError.fetch_add(inFlight.size(), std::memory_order_relaxed);
+        inFlight.clear();
+        tcpSocket.close();
+        {
+            std::lock_guard<std::mutex> lock(queueMutex);
+            isActive = false;
+            writing = false;
+        }
+        scheduleReconnect();
+        return;
+    }
+
+    sent.fetch_add(inFlight.size(), std::memory_order_relaxed);
+    inFlight.clear();
+    startWrite();
 }
@@ -2,24 +2,104 @@
 
 #include <boost/asio.hpp>
 
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
 using boost::asio::ip::tcp;
 
+/// \brief Settings of the TCP exporter.
+struct TcpConfig
+{
+    /// Maximum number of bytes (including frame headers) waiting to be sent. Further reports are
+    /// dropped.
+    size_t maxQueuedBytes = 64 << 20;
+    /// Maximum number of bytes combined into a single write.
+    size_t maxBatchBytes = 256 << 10;
+    /// Delay before the first reconnection attempt. Doubled after every failed attempt.
+    std::chrono::milliseconds minBackoff{100};
+    /// Upper limit of the reconnection delay.
+    std::chrono::milliseconds maxBackoff{30000};
+};
+
+/// \brief Counters of the TCP exporter.
+struct TcpStats
+{
+    uint64_t sent = 0;           ///< Reports written to the socket
+    uint64_t droppedQueueFull = 0; ///< Reports dropped because the queue was full
+    uint64_t droppedError = 0;   ///< Reports lost in a failed write
+    uint64_t reconnects = 0;     ///< Successful connections after a connection loss
+};
+
+/// \brief Asynchronous TCP exporter for INT reports.
+///
+/// Every report is sent as a frame consisting of its length as 32-bit unsigned integer in network
+/// byte order followed by the report. send() only appends the frame to a bounded queue; an I/O
+/// thread writes all queued frames with a single scatter/gather write. If the connection fails,
+/// the client reconnects with exponential backoff while reports keep being queued.
 class tcpClient
 {
     public:
-        // Methods: 
-        tcpClient();
+        // Methods:
+        tcpClient(const TcpConfig& config = TcpConfig());
+        ~tcpClient();
+
+        tcpClient(const tcpClient&) = delete;
+        tcpClient& operator=(const tcpClient&) = delete;
+
+        /// \brief Start connecting to the server in the background.
         bool createClient(const tcp::endpoint& ep);
-        bool send(const std::string& report);
-        
+
+        /// \brief Queue a report for sending. Does not block on the socket. Thread-safe.
+        /// \return False if the report was dropped or the client was never started.
+        bool send(std::string_view report);
+
+        /// \brief Stop the I/O thread. Reports still queued are discarded.
+        void close();
+
         // Getter:
+        /// \brief True if the client is currently connected to the server.
         bool getIsActive();
+        TcpStats getStats() const;
+
     private:
-        // Methods:
-        bool write(const void* data, size_t size);
-        bool write(const std::string& data);
-        
+        // Methods (run on the I/O thread):
+        void connect();
+        void scheduleReconnect();
+        void startWrite();
+        void onWrite(const boost::system::error_code& err);
+
         // Attributes:
-        std::unique_ptr<tcp::socket> tcpSocket;
-        bool isActive;
+        TcpConfig config;
+        boost::asio::io_context ioContext;
+        std::optional<boost::asio::executor_work_guard<boost::asio::io_context::executor_type>> work;
+        std::thread ioThread;
+        tcp::socket tcpSocket;
+        tcp::endpoint endpoint;
+        boost::asio::steady_timer reconnectTimer;
+        std::chrono::milliseconds backoff;
+        std::atomic<bool> isActive;
+        bool wasConnected;
+
+        // Frames waiting to be sent, protected by queueMutex
+        std::mutex queueMutex;
+        std::deque<std::string> queue;
+        size_t queuedBytes;
+        bool writing;
+
+        // Frames of the write in progress (I/O thread only)
+        std::vector<std::string> inFlight;
+        std::vector<boost::asio::const_buffer> buffers;
+
+        std::atomic<uint64_t> sent = 0;
+        std::atomic<uint64_t> droppedQueueFull = 0;
+        std::atomic<uint64_t> droppedError = 0;
+        std::atomic<uint64_t> reconnects = 0;
 };
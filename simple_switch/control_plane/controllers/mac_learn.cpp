@@ -60,9 +60,11 @@ void MacLearningCtrl::handleArbitrationUpdate(
 {
     if (!arbUpdate.status().code())
     {
-        createFloodMulticastGroup(con);
-        installStaticTableEntries(con);
-        configDigestMessages(con);
+        // Learned entries are kept in the store as well and survive a reconnect
+        recordFloodMulticastGroups();
+        recordStaticTableEntries();
+        recordDigestConfig();
+        store.reconcile(con);
     }
 }
 
@@ -87,16 +89,18 @@ bool MacLearningCtrl::handleDigest(SwitchConnection &con, const p4::v1::DigestLi
             std::cout << srcMac << " is behind port " << ingressPort << std::endl;
 
             // Update learn and forward table
-            writeRequest.addUpdate(p4::v1::Update::INSERT, buildLearnTableEntry(srcMac));
-            writeRequest.addUpdate(p4::v1::Update::INSERT, buildForwardTableEntry(srcMac,
+            store.addUpdate(writeRequest, p4::v1::Update::INSERT, buildLearnTableEntry(srcMac));
+            store.addUpdate(writeRequest, p4::v1::Update::INSERT, buildForwardTableEntry(srcMac,
                 ingressPort));
         }
 
-        // Send updates to dataplane
-        con.sendWriteRequest(writeRequest);
-
-        // Acknowledge digests
-        con.ackDigestList(digestList.digest_id(), digestList.list_id());
+        // Send updates to the data plane without blocking the stream. The digests are only
+        // acknowledged once the entries exist, otherwise the same MAC could be learned twice.
+        con.sendWriteRequestAsync(std::move(writeRequest),
+            [&con, digestId = digestList.digest_id(), listId = digestList.list_id()](bool) {
+                // Write callbacks must not block, the ack is sent by the connection's ack thread
+                con.queueDigestAck(digestId, listId);
+            });
 
         return true;
     }
@@ -108,29 +112,23 @@ bool MacLearningCtrl::handleDigest(SwitchConnection &con, const p4::v1::DigestLi
 /// multicast group of port n contains all other ports with the exception of the CPU port. Thereby,
 /// setting the multicast group of a packet entering the switch on port n to n floods the packet
 /// to all other ports.
-bool MacLearningCtrl::createFloodMulticastGroup(SwitchConnection &con)
+void MacLearningCtrl::recordFloodMulticastGroups()
 {
-    auto request = con.createWriteRequest();
     for (uint32_t i = 0; i < NUM_SWITCH_PORTS; ++i)
-        request.addUpdate(p4::v1::Update::INSERT, buildFloodMcastGrpEntity(i + 1, i));
-    return con.sendWriteRequest(request);
+        store.set(*buildFloodMcastGrpEntity(i + 1, i));
 }
 
-/// \brief Install table entries that are known a priori and should not be learned.
-bool MacLearningCtrl::installStaticTableEntries(SwitchConnection &con)
+/// \brief Record table entries that are known a priori and should not be learned.
+void MacLearningCtrl::recordStaticTableEntries()
 {
     // Create entry for broadcast address
-    auto request = con.createWriteRequest();
-    request.addUpdate(p4::v1::Update::INSERT, buildLearnTableEntry(0xFFFFFFFFFFFF));
-    return con.sendWriteRequest(request);
+    store.set(*buildLearnTableEntry(0xFFFFFFFFFFFF));
 }
 
-/// \brief Configure the transmission of digests.
-bool MacLearningCtrl::configDigestMessages(SwitchConnection &con)
+/// \brief Record the configuration of digest transmission.
+void MacLearningCtrl::recordDigestConfig()
 {
-    auto request = con.createWriteRequest();
-    request.addUpdate(p4::v1::Update::INSERT, buildDigestEntity(macLearnDigestId));
-    return con.sendWriteRequest(request);
+    store.set(*buildDigestEntity(macLearnDigestId));
 }
 
 
@@ -3,6 +3,7 @@
 #include "common.h"
 #include "connection.h"
 #include "controller.h"
+#include "entity_store.h"
 
 
 /// \brief A simple controller for L2 MAC learning without aging or support for moving a MAC from
@@ -15,9 +16,9 @@ public:
 private:
     /// \name Initialization Functions
     ///@{
-    bool createFloodMulticastGroup(SwitchConnection &con);
-    bool installStaticTableEntries(SwitchConnection &con);
-    bool configDigestMessages(SwitchConnection &con);
+    void recordFloodMulticastGroups();
+    void recordStaticTableEntries();
+    void recordDigestConfig();
     ///@}
 
     /// \name Stream Message Handlers
@@ -29,4 +30,5 @@ private:
 
 private:
     uint32_t macLearnDigestId;
+    EntityStore store;
 };
@@ -0,0 +1,214 @@
+#pragma once
+
+#include <p4/v1/p4runtime.pb.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+
+/// \file
+/// Canonical form of P4Runtime entities, used by EntityStore to match the entities read from a
+/// switch with the recorded ones. Switches may return bitstrings with or without leading zero
+/// bytes, so bitstrings are compared without them.
+
+namespace entity_key {
+
+/// \brief Remove leading zero bytes from a bitstring. Zero is represented by a single zero byte.
+inline std::string canonicalBitstring(const std::string& bitstring)
+{
+    auto first = bitstring.find_first_not_of('\0');
+    if (first == std::string::npos)
+        return std::string(1, '\0');
+    return bitstring.substr(first);
+}
+
+inline void appendUint(std::string& out, uint64_t value)
+{
+    out.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+inline void appendBitstring(std::string& out, const std::string& bitstring)
+{
+    auto canonical = canonicalBitstring(bitstring);
+    appendUint(out, canonical.size());
+    out += canonical;
+}
+
+/// \brief Apply a ternary mask to a value. Both are aligned at their least significant byte.
+inline std::string maskedBitstring(const std::string& value, const std::string& mask)
+{
+    std::string out(std::min(value.size(), mask.size()), '\0');
+    for (size_t i = 1; i <= out.size(); ++i)
+        out[out.size() - i] = value[value.size() - i] & mask[mask.size() - i];
+    return out;
+}
+
+/// \brief Append the match fields of a table entry sorted by field ID.
+inline void appendMatch(std::string& out, const p4::v1::TableEntry& entry)
+{
+    std::vector<const p4::v1::FieldMatch*> fields;
+    for (const auto& field : entry.match())
+        fields.push_back(&field);
+    std::sort(fields.begin(), fields.end(),
+        [](auto a, auto b) { return a->field_id() < b->field_id(); });
+
+    for (auto field : fields)
+    {
+        appendUint(out, field->field_id());
+        appendUint(out, field->field_match_type_case());
+        switch (field->field_match_type_case())
+        {
+        case p4::v1::FieldMatch::kExact:
+            appendBitstring(out, field->exact().value());
+            break;
+        case p4::v1::FieldMatch::kTernary:
+            // Bits of the value outside of the mask do not matter
+            appendBitstring(out, maskedBitstring(field->ternary().value(), field->ternary().mask()));
+            appendBitstring(out, field->ternary().mask());
+            break;
+        case p4::v1::FieldMatch::kLpm:
+            appendBitstring(out, field->lpm().value());
+            appendUint(out, field->lpm().prefix_len());
+            break;
+        case p4::v1::FieldMatch::kRange:
+            appendBitstring(out, field->range().low());
+            appendBitstring(out, field->range().high());
+            break;
+        case p4::v1::FieldMatch::kOptional:
+            appendBitstring(out, field->optional().value());
+            break;
+        default:
+            out += field->SerializeAsString();
+            break;
+        }
+    }
+    appendUint(out, entry.priority());
+}
+
+/// \brief Canonical form of the action of a table entry.
+inline std::string actionValue(const p4::v1::TableEntry& entry)
+{
+    std::string out;
+    if (!entry.action().has_action())
+        return entry.action().SerializeAsString();
+
+    const auto& action = entry.action().action();
+    appendUint(out, action.action_id());
+    std::vector<const p4::v1::Action::Param*> params;
+    for (const auto& param : action.params())
+        params.push_back(&param);
+    std::sort(params.begin(), params.end(),
+        [](auto a, auto b) { return a->param_id() < b->param_id(); });
+    for (auto param : params)
+    {
+        appendUint(out, param->param_id());
+        appendBitstring(out, param->value());
+    }
+    return out;
+}
+
+/// \brief Replicas of a clone session or multicast group sorted by port and instance.
+template <typename Replicas>
+inline std::vector<std::pair<uint32_t, uint32_t>> sortedReplicas(const Replicas& replicas)
+{
+    std::vector<std::pair<uint32_t, uint32_t>> sorted;
+    for (const auto& replica : replicas)
+        sorted.emplace_back(replica.egress_port(), replica.instance());
+    std::sort(sorted.begin(), sorted.end());
+    return sorted;
+}
+
+} // namespace entity_key
+
+
+/// \brief Canonical key of an entity. Empty for unsupported entities.
+/// \details Table entries are identified by table ID, match fields sorted by field ID and priority,
+/// other entities by their IDs. Bitstrings are stripped of leading zero bytes.
+inline std::string entityKey(const p4::v1::Entity& entity)
+{
+    using namespace entity_key;
+    std::string out;
+    switch (entity.entity_case())
+    {
+    case p4::v1::Entity::kTableEntry:
+    {
+        const auto& entry = entity.table_entry();
+        out += 'T';
+        appendUint(out, entry.table_id());
+        // A table has a single default entry
+        if (entry.is_default_action())
+            out += 'D';
+        else
+            appendMatch(out, entry);
+        break;
+    }
+    case p4::v1::Entity::kPacketReplicationEngineEntry:
+    {
+        const auto& entry = entity.packet_replication_engine_entry();
+        if (entry.has_clone_session_entry())
+        {
+            out += 'C';
+            appendUint(out, entry.clone_session_entry().session_id());
+        }
+        else if (entry.has_multicast_group_entry())
+        {
+            out += 'M';
+            appendUint(out, entry.multicast_group_entry().multicast_group_id());
+        }
+        break;
+    }
+    case p4::v1::Entity::kDigestEntry:
+        out += 'G';
+        appendUint(out, entity.digest_entry().digest_id());
+        break;
+    default:
+        break;
+    }
+    return out;
+}
+
+/// \brief Test whether two entities with the same key describe the same state.
+inline bool entityValuesEqual(const p4::v1::Entity& a, const p4::v1::Entity& b)
+{
+    using namespace entity_key;
+    if (a.entity_case() != b.entity_case())
+        return false;
+
+    switch (a.entity_case())
+    {
+    case p4::v1::Entity::kTableEntry:
+        return actionValue(a.table_entry()) == actionValue(b.table_entry());
+    case p4::v1::Entity::kPacketReplicationEngineEntry:
+    {
+        const auto& pa = a.packet_replication_engine_entry();
+        const auto& pb = b.packet_replication_engine_entry();
+        if (pa.has_clone_session_entry() && pb.has_clone_session_entry())
+        {
+            const auto& ca = pa.clone_session_entry();
+            const auto& cb = pb.clone_session_entry();
+            return ca.class_of_service() == cb.class_of_service()
+                && ca.packet_length_bytes() == cb.packet_length_bytes()
+                && sortedReplicas(ca.replicas()) == sortedReplicas(cb.replicas());
+        }
+        if (pa.has_multicast_group_entry() && pb.has_multicast_group_entry())
+        {
+            return sortedReplicas(pa.multicast_group_entry().replicas())
+                == sortedReplicas(pb.multicast_group_entry().replicas());
+        }
+        return false;
+    }
+    case p4::v1::Entity::kDigestEntry:
+    {
+        const auto& ca = a.digest_entry().config();
+        const auto& cb = b.digest_entry().config();
+        return std::make_tuple(ca.max_timeout_ns(), ca.max_list_size(), ca.ack_timeout_ns())
+            == std::make_tuple(cb.max_timeout_ns(), cb.max_list_size(), cb.ack_timeout_ns());
+    }
+    default:
+        return false;
+    }
+}
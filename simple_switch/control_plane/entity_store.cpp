@@ -0,0 +1,196 @@
+#include "entity_store.h"
+
+#include <iostream>
+#include <utility>
+#include <vector>
+
+
+void EntityStore::ownTable(uint32_t tableId)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    ownedTables.insert(tableId);
+}
+
+void EntityStore::set(const p4::v1::Entity& entity)
+{
+    auto k = key(entity);
+    if (k.empty())
+        return;
+    std::lock_guard<std::mutex> lock(mutex);
+    entities[k] = entity;
+}
+
+void EntityStore::erase(const p4::v1::Entity& entity)
+{
+    auto k = key(entity);
+    std::lock_guard<std::mutex> lock(mutex);
+    entities.erase(k);
+}
+
+void EntityStore::addUpdate(WriteRequest& request, p4::v1::Update_Type type,
+    std::unique_ptr<p4::v1::Entity> entity)
+{
+    if (type == p4::v1::Update::DELETE)
+        erase(*entity);
+    else
+        set(*entity);
+    request.addUpdate(type, std::move(entity));
+}
+
+EntityStore::Diff EntityStore::lastDiff() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return diff;
+}
+
+std::string EntityStore::key(const p4::v1::Entity& entity)
+{
+    return entityKey(entity);
+}
+
+bool EntityStore::equal(const p4::v1::Entity& a, const p4::v1::Entity& b)
+{
+    return entityValuesEqual(a, b);
+}
+
+bool EntityStore::reconcile(SwitchConnection& con)
+{
+    std::unordered_map<std::string, p4::v1::Entity> intended;
+    std::unordered_set<uint32_t> owned;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        intended = entities;
+        owned = ownedTables;
+    }
+
+    // Tables and default entries are read in a single request. Reading a clone session, multicast
+    // group or digest that does not exist fails, so each of them is read on its own.
+    std::vector<p4::v1::Entity> tableReads;
+    std::vector<p4::v1::Entity> otherReads;
+    std::unordered_set<uint32_t> tables = owned;
+    for (const auto& [k, entity] : intended)
+    {
+        p4::v1::Entity read;
+        switch (entity.entity_case())
+        {
+        case p4::v1::Entity::kTableEntry:
+            if (entity.table_entry().is_default_action())
+            {
+                auto entry = read.mutable_table_entry();
+                entry->set_table_id(entity.table_entry().table_id());
+                entry->set_is_default_action(true);
+                tableReads.push_back(std::move(read));
+            }
+            else
+            {
+                tables.insert(entity.table_entry().table_id());
+            }
+            break;
+        case p4::v1::Entity::kPacketReplicationEngineEntry:
+        {
+            const auto& pre = entity.packet_replication_engine_entry();
+            auto entry = read.mutable_packet_replication_engine_entry();
+            if (pre.has_clone_session_entry())
+                entry->mutable_clone_session_entry()->set_session_id(
+                    pre.clone_session_entry().session_id());
+            else
+                entry->mutable_multicast_group_entry()->set_multicast_group_id(
+                    pre.multicast_group_entry().multicast_group_id());
+            otherReads.push_back(std::move(read));
+            break;
+        }
+        case p4::v1::Entity::kDigestEntry:
+            read.mutable_digest_entry()->set_digest_id(entity.digest_entry().digest_id());
+            otherReads.push_back(std::move(read));
+            break;
+        default:
+            break;
+        }
+    }
+    for (auto tableId : tables)
+    {
+        p4::v1::Entity read;
+        read.mutable_table_entry()->set_table_id(tableId);
+        tableReads.push_back(std::move(read));
+    }
+
+    // Compare the state of the switch with the store
+    Diff result;
+    std::unordered_set<std::string> present;
+    auto deletes = con.createWriteRequest();
+    auto updates = con.createWriteRequest();
+    auto visit = [&](const p4::v1::Entity& entity) {
+        auto k = key(entity);
+        if (k.empty())
+            return;
+        auto i = intended.find(k);
+        if (i == intended.end())
+        {
+            // Stale entries of owned tables are removed, only the key is needed for that
+            if (!entity.has_table_entry())
+                return;
+            const auto& entry = entity.table_entry();
+            if (!entry.is_default_action() && owned.count(entry.table_id()))
+            {
+                auto stale = std::make_unique<p4::v1::Entity>();
+                auto staleEntry = stale->mutable_table_entry();
+                staleEntry->set_table_id(entry.table_id());
+                *staleEntry->mutable_match() = entry.match();
+                staleEntry->set_priority(entry.priority());
+                deletes.addUpdate(p4::v1::Update::DELETE, std::move(stale));
+                ++result.deleted;
+            }
+            return;
+        }
+        if (!present.insert(k).second)
+            return;
+        if (equal(i->second, entity))
+        {
+            ++result.unchanged;
+            return;
+        }
+        updates.addUpdate(p4::v1::Update::MODIFY, std::make_unique<p4::v1::Entity>(i->second));
+        ++result.modified;
+    };
+
+    if (!tableReads.empty() && !con.sendReadRequest(tableReads, visit))
+    {
+        // Nothing is known about the tables, fall back to inserting all entries
+        std::cout << "Reading the tables failed, writing all entries" << std::endl;
+        deletes = con.createWriteRequest();
+        updates = con.createWriteRequest();
+        present.clear();
+        result = Diff();
+    }
+    for (const auto& read : otherReads)
+    {
+        // Entities that cannot be read are treated as missing
+        con.sendReadRequest(std::span(&read, 1), visit);
+    }
+
+    for (const auto& [k, entity] : intended)
+    {
+        if (present.count(k))
+            continue;
+        // Default entries always exist
+        bool isDefault = entity.has_table_entry() && entity.table_entry().is_default_action();
+        updates.addUpdate(isDefault ? p4::v1::Update::MODIFY : p4::v1::Update::INSERT,
+            std::make_unique<p4::v1::Entity>(entity));
+        ++(isDefault ? result.modified : result.inserted);
+    }
+
+    // Stale entries are deleted first, they may occupy space needed by new entries
+    bool success = true;
+    if (result.deleted)
+        success = con.sendWriteRequestAsync(std::move(deletes)).get();
+    if (result.inserted || result.modified)
+        success = con.sendWriteRequestAsync(std::move(updates)).get() && success;
+
+    std::cout << "Reconciled " << std::dec << intended.size() << " entities: "
+        << result.inserted << " inserted, " << result.modified << " modified, "
+        << result.deleted << " deleted, " << result.unchanged << " unchanged" << std::endl;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    diff = result;
+    return success;
+}
@@ -0,0 +1,75 @@
+#pragma once
+
+#include "connection.h"
+#include "entity_key.h"
+
+#include <p4/v1/p4runtime.pb.h>
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+
+
+/// \brief Shadow copy of the entities a controller intends to exist in the data plane.
+///
+/// Controllers record their entities with set() instead of inserting them directly. After an
+/// arbitration, reconcile() reads the state of the switch back and writes only the difference:
+/// missing entities are inserted, differing entities are modified and entries of tables owned by
+/// the store that it does not know about are deleted. Entities are identified by a canonical key
+/// (table ID and match fields for table entries, IDs for other entities), values are compared with
+/// bitstrings in canonical form, so padded and unpadded values are equal.
+///
+/// Supported entities are table entries (including default entries), clone sessions, multicast
+/// groups and digest configurations. All functions are thread-safe.
+class EntityStore
+{
+public:
+    /// \brief Statistics of the last reconciliation.
+    struct Diff
+    {
+        size_t inserted = 0;
+        size_t modified = 0;
+        size_t deleted = 0;
+        size_t unchanged = 0;
+    };
+
+    /// \brief Delete entries of the table the store has no entity for during reconciliation.
+    /// \details Tables whose entries are added by the data plane or other controllers must not be
+    /// owned, their unknown entries are left alone.
+    void ownTable(uint32_t tableId);
+
+    /// \brief Record an entity. Replaces an entity with the same key.
+    void set(const p4::v1::Entity& entity);
+
+    /// \brief Forget an entity. Only the key fields of the entity must be set.
+    void erase(const p4::v1::Entity& entity);
+
+    /// \brief Add the entities of an update to the store as well as to a write request.
+    /// \details Inserted and modified entities are recorded, deleted entities are forgotten.
+    void addUpdate(WriteRequest& request, p4::v1::Update_Type type,
+        std::unique_ptr<p4::v1::Entity> entity);
+
+    /// \brief Read back the state of the switch and write the difference to the recorded state.
+    /// \details If the switch cannot be read, all recorded entities are inserted. Default entries
+    /// are always modified, since they cannot be inserted.
+    /// \return True if the state of the switch matches the store afterwards.
+    bool reconcile(SwitchConnection& con);
+
+    /// \brief Statistics of the last call to reconcile().
+    Diff lastDiff() const;
+
+    /// \brief Canonical key of an entity. Empty for unsupported entities.
+    static std::string key(const p4::v1::Entity& entity);
+
+    /// \brief Test whether two entities with the same key describe the same state.
+    static bool equal(const p4::v1::Entity& a, const p4::v1::Entity& b);
+
+private:
+    mutable std::mutex mutex;
+    std::unordered_map<std::string, p4::v1::Entity> entities; // by key
+    std::unordered_set<uint32_t> ownedTables;
+    Diff diff;
+};
@@ -5,7 +5,9 @@
 
 #include <google/protobuf/message.h>
 #include <google/protobuf/text_format.h>
+#include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/io/zero_copy_stream_impl.h>
+#include <google/protobuf/io/zero_copy_stream_impl_lite.h>
 
 #include <fcntl.h>
 #include <unistd.h>
@@ -52,3 +54,29 @@ DeviceConfig loadDeviceConfig(const char* filename)
     file.read(reinterpret_cast<char*>(config.data()), config.size());
     return config;
 }
+
+/// \brief Hash a P4Info message and device configuration into a pipeline cookie.
+/// \details The P4Info is serialized deterministically, so the same compiler artifacts always
+/// result in the same cookie. The FNV-1a hash is not cryptographic, it only has to tell pipelines
+/// apart. Zero is never returned, since it indicates that a switch has no cookie.
+uint64_t pipelineCookie(const p4::config::v1::P4Info& p4Info, const DeviceConfig& deviceConfig)
+{
+    std::string serialized;
+    {
+        google::protobuf::io::StringOutputStream stringStream(&serialized);
+        google::protobuf::io::CodedOutputStream stream(&stringStream);
+        stream.SetSerializationDeterministic(true);
+        p4Info.SerializeToCodedStream(&stream);
+    }
+
+    uint64_t hash = 0xcbf29ce484222325ull;
+    auto update = [&hash](uint8_t byte) {
+        hash ^= byte;
+        hash *= 0x100000001b3ull;
+    };
+    for (char c : serialized)
+        update(static_cast<uint8_t>(c));
+    for (std::byte b : deviceConfig)
+        update(static_cast<uint8_t>(b));
+    return hash ? hash : 1;
+}
@@ -2,7 +2,9 @@
 
 #include "common.h"
 #include <p4/config/v1/p4info.pb.h>
+#include <cstdint>
 #include <memory>
 
 std::unique_ptr<p4::config::v1::P4Info> loadP4Info(const char* filename);
 DeviceConfig loadDeviceConfig(const char* filename);
+uint64_t pipelineCookie(const p4::config::v1::P4Info& p4Info, const DeviceConfig& deviceConfig);
@@ -0,0 +1,92 @@
+#pragma once
+
+#include "common.h"
+
+#include <boost/lockfree/queue.hpp>
+#include <boost/lockfree/spsc_queue.hpp>
+
+#include <atomic>
+#include <cstdint>
+
+
+/// \brief Bounded lock-free ring buffer with blocking push and pop.
+///
+/// Producers and consumers only touch the lock-free queue on the fast path. A thread blocks on an
+/// atomic counter if the queue is full (producer) or empty (consumer) and is woken up by the
+/// other side.
+/// \tparam T Element type. Should be cheap to copy, e.g., a pointer.
+/// \tparam Queue boost::lockfree::spsc_queue for a single producer and consumer,
+/// boost::lockfree::queue for multiple producers and consumers.
+template <typename T, typename Queue>
+class BlockingRing
+{
+public:
+    explicit BlockingRing(size_t capacity)
+        : queue(capacity)
+    {}
+
+    /// \brief Append an element. Blocks while the ring is full.
+    void push(T value)
+    {
+        while (true)
+        {
+            auto seen = pops.load(std::memory_order_acquire);
+            if (queue.push(value))
+                break;
+            pops.wait(seen, std::memory_order_acquire);
+        }
+        pushes.fetch_add(1, std::memory_order_release);
+        pushes.notify_one();
+    }
+
+    /// \brief Append an element if there is space.
+    /// \return False if the ring is full.
+    bool tryPush(T value)
+    {
+        if (!queue.push(value))
+            return false;
+        pushes.fetch_add(1, std::memory_order_release);
+        pushes.notify_one();
+        return true;
+    }
+
+    /// \brief Remove the oldest element. Blocks while the ring is empty.
+    T pop()
+    {
+        T value;
+        while (true)
+        {
+            auto seen = pushes.load(std::memory_order_acquire);
+            if (queue.pop(value))
+                break;
+            pushes.wait(seen, std::memory_order_acquire);
+        }
+        pops.fetch_add(1, std::memory_order_release);
+        pops.notify_one();
+        return value;
+    }
+
+    /// \brief Remove the oldest element if there is one.
+    /// \return False if the ring is empty.
+    bool tryPop(T& value)
+    {
+        if (!queue.pop(value))
+            return false;
+        pops.fetch_add(1, std::memory_order_release);
+        pops.notify_one();
+        return true;
+    }
+
+private:
+    Queue queue;
+    std::atomic<uint64_t> pushes = 0;
+    std::atomic<uint64_t> pops = 0;
+};
+
+/// Ring buffer for exactly one producer and one consumer thread.
+template <typename T>
+using SpscRing = BlockingRing<T, boost::lockfree::spsc_queue<T>>;
+
+/// Ring buffer for any number of producer and consumer threads.
+template <typename T>
+using MpmcRing = BlockingRing<T, boost::lockfree::queue<T, boost::lockfree::fixed_sized<true>>>;
@@ -0,0 +1,199 @@
+#include "entity_key.h"
+
+#include <doctest/doctest.h>
+
+#include <p4/v1/p4runtime.pb.h>
+
+#include <cstdint>
+#include <string>
+
+
+using p4::v1::Entity;
+
+static Entity tableEntry(uint32_t tableId, int32_t priority = 0)
+{
+    Entity entity;
+    entity.mutable_table_entry()->set_table_id(tableId);
+    entity.mutable_table_entry()->set_priority(priority);
+    return entity;
+}
+
+static void addExact(Entity& entity, uint32_t fieldId, const std::string& value)
+{
+    auto match = entity.mutable_table_entry()->add_match();
+    match->set_field_id(fieldId);
+    match->mutable_exact()->set_value(value);
+}
+
+static void addTernary(Entity& entity, uint32_t fieldId, const std::string& value,
+    const std::string& mask)
+{
+    auto match = entity.mutable_table_entry()->add_match();
+    match->set_field_id(fieldId);
+    match->mutable_ternary()->set_value(value);
+    match->mutable_ternary()->set_mask(mask);
+}
+
+static void addLpm(Entity& entity, uint32_t fieldId, const std::string& value, int32_t prefixLen)
+{
+    auto match = entity.mutable_table_entry()->add_match();
+    match->set_field_id(fieldId);
+    match->mutable_lpm()->set_value(value);
+    match->mutable_lpm()->set_prefix_len(prefixLen);
+}
+
+static void setAction(Entity& entity, uint32_t actionId, const std::string& param)
+{
+    auto action = entity.mutable_table_entry()->mutable_action()->mutable_action();
+    action->set_action_id(actionId);
+    action->clear_params();
+    auto p = action->add_params();
+    p->set_param_id(1);
+    p->set_value(param);
+}
+
+
+TEST_SUITE("EntityKey") {
+
+TEST_CASE("canonicalBitstring")
+{
+    using entity_key::canonicalBitstring;
+    CHECK(canonicalBitstring(std::string("\x00\x00\x12\x34", 4)) == "\x12\x34");
+    CHECK(canonicalBitstring("\x12\x34") == "\x12\x34");
+    CHECK(canonicalBitstring(std::string("\x00\x00", 2)) == std::string(1, '\0'));
+    CHECK(canonicalBitstring("") == std::string(1, '\0'));
+}
+
+TEST_CASE("Exact match padding")
+{
+    auto a = tableEntry(1);
+    addExact(a, 1, std::string("\x00\x00\x00\x0a", 4));
+    auto b = tableEntry(1);
+    addExact(b, 1, "\x0a");
+    CHECK(entityKey(a) == entityKey(b));
+
+    auto c = tableEntry(1);
+    addExact(c, 1, "\x0b");
+    CHECK(entityKey(a) != entityKey(c));
+
+    // Same match in another table
+    auto d = tableEntry(2);
+    addExact(d, 1, "\x0a");
+    CHECK(entityKey(a) != entityKey(d));
+}
+
+TEST_CASE("Match field order")
+{
+    auto a = tableEntry(1);
+    addExact(a, 1, "\x01");
+    addExact(a, 2, "\x02");
+    auto b = tableEntry(1);
+    addExact(b, 2, std::string("\x00\x02", 2));
+    addExact(b, 1, "\x01");
+    CHECK(entityKey(a) == entityKey(b));
+}
+
+TEST_CASE("Ternary masks")
+{
+    auto a = tableEntry(1, 10);
+    addTernary(a, 1, std::string("\x00\x12\x00", 3), std::string("\x00\xff\x00", 3));
+    auto b = tableEntry(1, 10);
+    addTernary(b, 1, std::string("\x12\x00", 2), std::string("\xff\x00", 2));
+    CHECK(entityKey(a) == entityKey(b));
+
+    // Bits of the value outside of the mask are ignored
+    auto c = tableEntry(1, 10);
+    addTernary(c, 1, "\x12\x34", std::string("\xff\x00", 2));
+    CHECK(entityKey(a) == entityKey(c));
+
+    // A different mask or priority is a different entry
+    auto d = tableEntry(1, 10);
+    addTernary(d, 1, std::string("\x12\x00", 2), "\xff\xf0");
+    CHECK(entityKey(a) != entityKey(d));
+    auto e = tableEntry(1, 11);
+    addTernary(e, 1, std::string("\x12\x00", 2), std::string("\xff\x00", 2));
+    CHECK(entityKey(a) != entityKey(e));
+}
+
+TEST_CASE("LPM prefixes")
+{
+    auto a = tableEntry(1);
+    addLpm(a, 1, std::string("\x00\x0a\x00\x00\x00", 5), 8);
+    auto b = tableEntry(1);
+    addLpm(b, 1, std::string("\x0a\x00\x00\x00", 4), 8);
+    CHECK(entityKey(a) == entityKey(b));
+
+    auto c = tableEntry(1);
+    addLpm(c, 1, std::string("\x0a\x00\x00\x00", 4), 16);
+    CHECK(entityKey(a) != entityKey(c));
+}
+
+TEST_CASE("Default entries")
+{
+    auto a = tableEntry(1);
+    a.mutable_table_entry()->set_is_default_action(true);
+    setAction(a, 5, "\x01");
+    auto b = tableEntry(1);
+    b.mutable_table_entry()->set_is_default_action(true);
+    setAction(b, 6, "\x02");
+    CHECK(entityKey(a) == entityKey(b));
+    CHECK(entityKey(a) != entityKey(tableEntry(1)));
+}
+
+TEST_CASE("Action values")
+{
+    auto a = tableEntry(1);
+    addExact(a, 1, "\x01");
+    setAction(a, 5, std::string("\x00\x00\x03\xe8", 4));
+    auto b = tableEntry(1);
+    addExact(b, 1, "\x01");
+    setAction(b, 5, "\x03\xe8");
+    CHECK(entityValuesEqual(a, b));
+
+    setAction(b, 5, "\x03\xe9");
+    CHECK_FALSE(entityValuesEqual(a, b));
+    setAction(b, 6, "\x03\xe8");
+    CHECK_FALSE(entityValuesEqual(a, b));
+}
+
+TEST_CASE("Replicas and digests")
+{
+    Entity a;
+    auto groupA = a.mutable_packet_replication_engine_entry()->mutable_multicast_group_entry();
+    groupA->set_multicast_group_id(3);
+    Entity b = a;
+    auto groupB = b.mutable_packet_replication_engine_entry()->mutable_multicast_group_entry();
+    for (uint32_t port : {1, 2})
+    {
+        auto replica = groupA->add_replicas();
+        replica->set_egress_port(port);
+        replica->set_instance(port);
+    }
+    for (uint32_t port : {2, 1})
+    {
+        auto replica = groupB->add_replicas();
+        replica->set_egress_port(port);
+        replica->set_instance(port);
+    }
+    CHECK(entityKey(a) == entityKey(b));
+    CHECK(entityValuesEqual(a, b));
+    groupB->mutable_replicas(0)->set_egress_port(4);
+    CHECK_FALSE(entityValuesEqual(a, b));
+
+    Entity c, d;
+    c.mutable_digest_entry()->set_digest_id(7);
+    c.mutable_digest_entry()->mutable_config()->set_max_list_size(64);
+    d = c;
+    CHECK(entityKey(c) == entityKey(d));
+    CHECK(entityValuesEqual(c, d));
+    d.mutable_digest_entry()->mutable_config()->set_max_list_size(1);
+    CHECK_FALSE(entityValuesEqual(c, d));
+    CHECK(entityKey(c) != entityKey(a));
+
+    // Unsupported entities have no key
+    Entity counter;
+    counter.mutable_counter_entry()->set_counter_id(1);
+    CHECK(entityKey(counter).empty());
+}
+
+}
@@ -1,10 +1,15 @@
 #include "controllers/int/addressConversion.h"
+#include "controllers/int/intDecoder.h"
+#include "controllers/int/intTableEntries.h"
+#include "controllers/int/reportEncoder.h"
 #include "controllers/int/readIntTable.h"
 #include "controllers/int/takeUint.h"
 
 #include <doctest/doctest.h>
 
 #include <algorithm>
+#include <cstddef>
+#include <span>
 #include <cstdint>
 #include <string>
 #include <vector>
@@ -49,20 +54,24 @@ TEST_CASE("ReadTable")
     std::vector<uint64_t> asList;
     std::vector<uint16_t> bitmaskIntList;
     std::vector<uint16_t> bitmaskScionList;
+    std::vector<bool> postcardList;
+    std::vector<IntSampling> samplingList;
     
     std::vector<uint64_t> asList2;
     std::vector<uint16_t> bitmaskIntList2;
     std::vector<uint16_t> bitmaskScionList2;
     
     std::string tablePath = "int_table1.txt";
-    readIntTable(tablePath, asList, bitmaskIntList, bitmaskScionList);
+    readIntTable(tablePath, asList, bitmaskIntList, bitmaskScionList, postcardList, samplingList);
     
     CHECK(asList == asList2);
     CHECK(bitmaskIntList == bitmaskIntList2);
     CHECK(bitmaskScionList == bitmaskScionList2);
+    CHECK(postcardList.empty());
+    CHECK(samplingList.empty());
     
     tablePath = "int_table2.txt";
-    readIntTable(tablePath, asList, bitmaskIntList, bitmaskScionList);
+    readIntTable(tablePath, asList, bitmaskIntList, bitmaskScionList, postcardList, samplingList);
     
     asList2 = {0x0001ff0000000001ull, 0x0001ff0000000020ull, 0x0001ff00ff000300ull, 0x000fff0000000004ull};
     bitmaskIntList2 = {0, 0, 0x8d00, 0xffff};
@@ -74,6 +83,20 @@ TEST_CASE("ReadTable")
         CHECK(bitmaskIntList[i] == bitmaskIntList2[i]);
         CHECK(bitmaskScionList[i] == bitmaskScionList2[i]);
     }
+    CHECK(postcardList == std::vector<bool>{false, false, false, true});
+    REQUIRE(samplingList.size() == 4);
+    CHECK(samplingList[0].mode == IntSampleMode::All);
+    CHECK(samplingList[2].mode == IntSampleMode::Flow);
+    CHECK(samplingList[2].rate == 16);
+    CHECK(samplingList[3].mode == IntSampleMode::First);
+    CHECK(samplingList[3].rate == 100);
+
+    CHECK(parseIntSampling("random/8").mode == IntSampleMode::Random);
+    CHECK(parseIntSampling("all").mode == IntSampleMode::All);
+    CHECK_THROWS(parseIntSampling("random"));
+    CHECK_THROWS(parseIntSampling("flow/0"));
+    CHECK_THROWS(parseIntSampling("first/70000"));
+    CHECK_THROWS(parseIntSampling("sometimes/2"));
 }
 
 TEST_CASE("TakeUint")
@@ -88,4 +111,370 @@ TEST_CASE("TakeUint")
     CHECK(takeUint8(strChar, 15) == 0x15);
 }
 
+/// Build a packet-in payload as generated by the INT sink with the given hop metadata.
+/// The destination host is 10.0.0.2 and the source host 10.0.0.1, or fd00::2 and fd00::1 if ipv6.
+static std::string buildIntPacketIn(uint16_t bitmapInt, uint16_t bitmapScion, uint8_t hopWords,
+    const std::string& stack, bool ipv6 = false)
+{
+    std::string str;
+    size_t hostBytes = ipv6 ? 16 : 4;
+    // int_cpu header
+    str.append({'\x00', '\x00', '\x00', '\x00', '\x00', '\x49', '\x4e', '\x54'});
+    str.append(7, '\x00');
+    str.push_back(static_cast<char>(52 + 2 * hostBytes));
+    // SCION common header with flow ID 0xabcde, next header UDP and host address types
+    str.append({'\x00', '\x0a', '\xbc', '\xde', '\x11', '\x00', '\x00', '\x00', '\x01'});
+    str.push_back(ipv6 ? '\x33' : '\x00');
+    str.append(2, '\x00');
+    // SCION address header with destination 1-ff00:0:4 and source 1-ff00:0:1
+    str.append({'\x00', '\x01', '\xff', '\x00', '\x00', '\x00', '\x00', '\x04'});
+    str.append({'\x00', '\x01', '\xff', '\x00', '\x00', '\x00', '\x00', '\x01'});
+    for (char host : {'\x02', '\x01'})
+    {
+        if (ipv6)
+            str.append({'\xfd', '\x00'}).append(13, '\x00').push_back(host);
+        else
+            str.append({'\x0a', '\x00', '\x00', host});
+    }
+    // UDP header with source port 8080
+    str.append({'\x1f', '\x90', '\x00', '\x00'});
+    str.append(4, '\x00');
+    // INT shim header
+    auto shimLen = static_cast<char>(3 + stack.size() / 4);
+    str.append({'\x10', shimLen, '\x30', '\x39'});
+    // INT-MD header
+    str.append({'\x20', '\x00', static_cast<char>(hopWords), '\x0a'});
+    str.append({static_cast<char>(bitmapInt >> 8), static_cast<char>(bitmapInt & 0xff)});
+    str.append({'\x00', '\x01'});
+    str.append({static_cast<char>(bitmapScion >> 8), static_cast<char>(bitmapScion & 0xff)});
+    str.append({'\x00', '\x00'});
+    return str + stack;
+}
+
+TEST_CASE("IntHopLayout")
+{
+    auto layout = IntHopLayout::make(0x8d00, 0x0001);
+    CHECK(layout.hopBytes == 32);
+    CHECK(layout.has(INT_FIELD_NODE_ID));
+    CHECK(!layout.has(INT_FIELD_L1_IF_ID));
+    CHECK(layout.offset[INT_FIELD_INGRESS_TIME] == 4);
+    CHECK(layout.offset[INT_FIELD_EGRESS_TIME] == 12);
+    CHECK(layout.offset[INT_FIELD_EG_IF_UTIL] == 20);
+    CHECK(layout.offset[INT_FIELD_AS_ADDR] == 24);
+
+    layout = IntHopLayout::make(0xff80, 0x0000);
+    CHECK(layout.hopBytes == 48);
+    CHECK(!layout.has(INT_FIELD_AS_ADDR));
+    CHECK(layout.offset[INT_FIELD_BUFFER_INFOS] == 44);
+}
+
+TEST_CASE("IntDecoder")
+{
+    std::string hop1, hop2;
+    hop1.assign({'\x00', '\x00', '\x00', '\x02'});
+    hop1.append({'\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x10', '\x00'});
+    hop1.append({'\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x10', '\x20'});
+    hop1.append({'\x00', '\x00', '\x01', '\x00'});
+    hop1.append({'\x00', '\x00', '\xff', '\x00', '\x00', '\x00', '\x00', '\x04'});
+    hop2 = hop1;
+    hop2[3] = '\x01';
+
+    IntDecoder decoder;
+    IntReport report;
+
+    // Generic decoder
+    auto str = buildIntPacketIn(0x8d00, 0x0000, 6, hop1.substr(0, 24) + hop2.substr(0, 24));
+    auto payload = std::as_bytes(std::span(str.data(), str.size()));
+    REQUIRE(decoder.decode(payload, report) == IntDecoder::Result::Ok);
+    CHECK(report.flow.flowId == 0xabcde);
+    CHECK(report.flow.dstIsdAs == 0x0001ff0000000004ull);
+    CHECK(report.flow.srcIsdAs == 0x0001ff0000000001ull);
+    CHECK(report.flow.srcPort == 8080);
+    CHECK(report.flow.dstPort == 12345);
+    CHECK(report.flow.protocol == 0x11);
+    CHECK(FlowIdentity::isIpv4(report.flow.dstHostType));
+    CHECK(loadBigEndian<uint32_t>(report.flow.dstHost.data()) == 0x0a000002u);
+    CHECK(loadBigEndian<uint32_t>(report.flow.srcHost.data()) == 0x0a000001u);
+    CHECK(report.headers.size() == 60);
+    REQUIRE(report.hops.size() == 2);
+    CHECK(report.hops[0].nodeId == 2);
+    CHECK(report.hops[1].nodeId == 1);
+    CHECK(report.hops[0].ingressTime == 0x1000);
+    CHECK(report.hops[0].egressTime == 0x1020);
+    CHECK(report.hops[0].egIfUtil == 0x100);
+    CHECK(!report.postcard);
+
+    // Specialized decoder
+    str = buildIntPacketIn(0x8d00, 0x0001, 8, hop1 + hop2);
+    payload = std::as_bytes(std::span(str.data(), str.size()));
+    REQUIRE(decoder.decode(payload, report) == IntDecoder::Result::Ok);
+    REQUIRE(report.hops.size() == 2);
+    CHECK(report.hops[1].nodeId == 1);
+    CHECK(report.hops[1].egressTime == 0x1020);
+    CHECK(report.hops[1].asAddr == 0xff0000000004ull);
+
+    // IPv6 hosts
+    str = buildIntPacketIn(0x8d00, 0x0001, 8, hop1 + hop2, true);
+    payload = std::as_bytes(std::span(str.data(), str.size()));
+    REQUIRE(decoder.decode(payload, report) == IntDecoder::Result::Ok);
+    CHECK(FlowIdentity::isIpv6(report.flow.srcHostType));
+    CHECK(loadBigEndian<uint64_t>(report.flow.dstHost.data()) == 0xfd00000000000000ull);
+    CHECK(loadBigEndian<uint64_t>(report.flow.dstHost.data() + 8) == 2);
+    CHECK(loadBigEndian<uint64_t>(report.flow.srcHost.data() + 8) == 1);
+    CHECK(report.flow.srcPort == 8080);
+    REQUIRE(report.hops.size() == 2);
+    CHECK(report.hops[1].nodeId == 1);
+
+    // Postcard with sequence number 0x1234 in the domain-specific flags
+    str = buildIntPacketIn(0x8d00, 0x0001, 8, hop1);
+    str[INT_CPU_HDR_BYTES + 44] = '\x30';
+    str[INT_CPU_HDR_BYTES + 58] = '\x12';
+    str[INT_CPU_HDR_BYTES + 59] = '\x34';
+    payload = std::as_bytes(std::span(str.data(), str.size()));
+    REQUIRE(decoder.decode(payload, report) == IntDecoder::Result::Ok);
+    CHECK(report.postcard);
+    CHECK(report.sequence == 0x1234);
+    REQUIRE(report.hops.size() == 1);
+    CHECK(report.hops[0].nodeId == 2);
+
+    // Host addresses do not fit into the headers
+    str = buildIntPacketIn(0x8d00, 0x0001, 8, hop1 + hop2);
+    str[INT_CPU_HDR_BYTES + 9] = '\x33';
+    payload = std::as_bytes(std::span(str.data(), str.size()));
+    CHECK(decoder.decode(payload, report) == IntDecoder::Result::Malformed);
+
+    // Hop length does not match the bitmap
+    str = buildIntPacketIn(0x8d00, 0x0001, 6, hop1.substr(0, 24) + hop2.substr(0, 24));
+    payload = std::as_bytes(std::span(str.data(), str.size()));
+    CHECK(decoder.decode(payload, report) == IntDecoder::Result::Malformed);
+
+    // Truncated INT stack
+    str = buildIntPacketIn(0x8d00, 0x0001, 8, hop1 + hop2);
+    str.resize(str.size() - 4);
+    payload = std::as_bytes(std::span(str.data(), str.size()));
+    CHECK(decoder.decode(payload, report) == IntDecoder::Result::Malformed);
+
+    // Not an INT packet
+    str[7] = '\x00';
+    payload = std::as_bytes(std::span(str.data(), str.size()));
+    CHECK(decoder.decode(payload, report) == IntDecoder::Result::NotInt);
+}
+
+TEST_CASE("IntDecoder layout cache")
+{
+    // Only bit 0 of the SCION bitmap selects a field, the other bits make distinct bitmap pairs
+    std::string hop(24, '\0');
+    hop[3] = '\x02';
+    IntDecoder decoder;
+    IntReport report;
+    std::vector<const IntHopLayout*> layouts;
+    for (uint16_t i = 0; i < IntDecoder::MAX_CACHED_LAYOUTS + 16; ++i)
+    {
+        auto str = buildIntPacketIn(0x8d00, i << 1, 6, hop);
+        auto payload = std::as_bytes(std::span(str.data(), str.size()));
+        REQUIRE(decoder.decode(payload, report) == IntDecoder::Result::Ok);
+        CHECK(report.layout->bitmapScion == (i << 1));
+        REQUIRE(report.hops.size() == 1);
+        CHECK(report.hops[0].nodeId == 2);
+        layouts.push_back(report.layout);
+    }
+
+    // Layouts beyond the limit are not cached
+    const size_t limit = IntDecoder::MAX_CACHED_LAYOUTS;
+    CHECK(layouts[0] != layouts[1]);
+    CHECK(layouts[limit] == layouts[limit + 1]);
+    auto str = buildIntPacketIn(0x8d00, 0x0002, 6, hop);
+    auto payload = std::as_bytes(std::span(str.data(), str.size()));
+    REQUIRE(decoder.decode(payload, report) == IntDecoder::Result::Ok);
+    CHECK(report.layout == layouts[1]);
+}
+
+TEST_CASE("IntDecoder digest")
+{
+    IntDecoder decoder;
+    IntReport report;
+
+    IntDigest digest;
+    digest.dstIsdAs = 0x0001ff0000000004ull;
+    digest.srcIsdAs = 0x0001ff0000000001ull;
+    digest.flowId = 0xabcde;
+    digest.protocol = 0x11;
+    digest.dstHostType = SCION_HOST_IPV4;
+    digest.srcHostType = SCION_HOST_IPV4;
+    digest.dstHost[3] = std::byte{2};
+    digest.dstHost[4] = std::byte{0xff}; // Beyond the IPv4 address
+    digest.srcHost[3] = std::byte{1};
+    digest.srcPort = 8080;
+    digest.dstPort = 12345;
+    digest.bitmapInt = 0xfc00;
+    digest.bitmapScion = 0x0001;
+    digest.hopML = 8;
+    digest.stackBits = 3 * 8 * 32;
+    digest.nodeId = 4;
+    digest.l1IfId = 0x00010002;
+    digest.hopLatency = 100;
+    digest.queue = 0x01000020;
+
+    REQUIRE(decoder.decode(digest, report) == IntDecoder::Result::Ok);
+    CHECK(report.flow.dstIsdAs == digest.dstIsdAs);
+    CHECK(report.flow.srcIsdAs == digest.srcIsdAs);
+    CHECK(report.flow.flowId == 0xabcdeu);
+    CHECK(report.flow.protocol == 0x11);
+    CHECK(report.flow.dstHost[3] == std::byte{2});
+    CHECK(report.flow.dstHost[4] == std::byte{0});
+    CHECK(report.flow.srcHost[3] == std::byte{1});
+    CHECK(report.flow.srcPort == 8080);
+    CHECK(report.flow.dstPort == 12345);
+    CHECK(report.headers.empty());
+    CHECK_FALSE(report.postcard);
+
+    // Only the first hop with the first four fields is reported
+    REQUIRE(report.layout != nullptr);
+    CHECK(report.layout->bitmapInt == 0xf000);
+    CHECK(report.layout->bitmapScion == 0x0000);
+    REQUIRE(report.hops.size() == 1);
+    CHECK(report.hops[0].nodeId == 4);
+    CHECK(report.hops[0].l1IfId == 0x00010002u);
+    CHECK(report.hops[0].hopLatency == 100);
+    CHECK(report.hops[0].queue == 0x01000020u);
+    CHECK(report.hops[0].ingressTime == 0);
+
+    // The data plane does not look ahead at stacks shorter than four words
+    digest.hopML = 2;
+    digest.stackBits = 64;
+    REQUIRE(decoder.decode(digest, report) == IntDecoder::Result::Ok);
+    CHECK(report.hops.empty());
+
+    // Stack length is not a multiple of the hop length
+    digest.stackBits = 96;
+    CHECK(decoder.decode(digest, report) == IntDecoder::Result::Malformed);
+    digest.hopML = 0;
+    CHECK(decoder.decode(digest, report) == IntDecoder::Result::Malformed);
+
+    // Encoded like a packet-in report without the truncated packet
+    digest.hopML = 1;
+    digest.stackBits = 4 * 32;
+    digest.bitmapInt = 0x8000;
+    digest.nodeId = 2;
+    REQUIRE(decoder.decode(digest, report) == IntDecoder::Result::Ok);
+    ReportEncoder encoder;
+    std::string expected = {'\x0a', '\x02', '\x10', '\x02', '\x10', '\x04'};
+    CHECK(encoder.encode(report) == expected);
+}
+
+TEST_CASE("buildIntSinkTableEntry")
+{
+    for (bool digest : {false, true})
+    {
+        auto entity = buildIntSinkTableEntry(1, 0xff0000000110, digest);
+        REQUIRE(entity->has_table_entry());
+        const auto& entry = entity->table_entry();
+        CHECK(entry.table_id() == TABLE_SCION_INT);
+        CHECK(entry.match_size() == 2);
+        CHECK(entry.match(1).exact().value() == std::string("\xff\x00\x00\x00\x01\x10", 6));
+
+        // The switch rejects entries without an action
+        REQUIRE(entry.action().has_action());
+        CHECK(entry.action().action().action_id() == (digest ? ACTION_DIGEST_INT : ACTION_CLONE_INT));
+        CHECK(entry.action().action().params_size() == 0);
+    }
+
+    auto entity = buildScionIntTableEntry(1, 0xff0000000111, 0xf000, 0, ACTION_INSERT_INT_MX);
+    CHECK(entity->table_entry().action().action().action_id() == ACTION_INSERT_INT_MX);
+    CHECK(entity->table_entry().action().action().params_size() == 4);
+    CHECK_THROWS(buildScionIntTableEntry(1, 0xff0000000111, 0, 0, ACTION_SET_MTU));
+}
+
+TEST_CASE("flowIdentityHash")
+{
+    FlowIdentity a;
+    a.flowId = 0xabcde;
+    a.srcIsdAs = 0x0001ff0000000001ull;
+    a.dstIsdAs = 0x0001ff0000000004ull;
+    a.srcPort = 8080;
+    a.dstPort = 12345;
+    a.protocol = 0x11;
+    a.dstHost[3] = std::byte{2};
+    a.srcHost[3] = std::byte{1};
+
+    FlowIdentity b = a;
+    CHECK(flowIdentityHash(a) == flowIdentityHash(b));
+
+    // Every part of the identity changes the hash
+    b = a; b.flowId ^= 1;
+    CHECK(flowIdentityHash(a) != flowIdentityHash(b));
+    b = a; b.srcIsdAs ^= 1;
+    CHECK(flowIdentityHash(a) != flowIdentityHash(b));
+    b = a; b.dstIsdAs ^= 1;
+    CHECK(flowIdentityHash(a) != flowIdentityHash(b));
+    b = a; b.srcPort ^= 1;
+    CHECK(flowIdentityHash(a) != flowIdentityHash(b));
+    b = a; b.dstPort ^= 1;
+    CHECK(flowIdentityHash(a) != flowIdentityHash(b));
+    b = a; b.protocol = 0x06;
+    CHECK(flowIdentityHash(a) != flowIdentityHash(b));
+    b = a; b.srcHost[3] = std::byte{3};
+    CHECK(flowIdentityHash(a) != flowIdentityHash(b));
+    b = a; b.dstHost[15] = std::byte{2};
+    CHECK(flowIdentityHash(a) != flowIdentityHash(b));
+}
+
+TEST_CASE("ReportEncoder")
+{
+    ReportEncoder encoder;
+    IntReport report;
+    std::string headers = "ab";
+    std::string expected;
+
+    auto layout = IntHopLayout::make(0x8000, 0x0000);
+    report.layout = &layout;
+    report.headers = std::as_bytes(std::span(headers.data(), headers.size()));
+    report.hops.resize(1);
+    report.hops[0].nodeId = 2;
+    expected.assign({'\x0a', '\x02', '\x10', '\x02', '\x10', '\x04', '\x1a', '\x02', 'a', 'b'});
+    CHECK(encoder.encode(report) == expected);
+
+    layout = IntHopLayout::make(0x2000, 0x0000);
+    report.headers = {};
+    report.hops[0].hopLatency = 0x100;
+    expected.assign({'\x0a', '\x0a', '\x1a', '\x08', '\x08', '\x02', '\x12', '\x04',
+        '\x00', '\x00', '\x01', '\x00', '\x10', '\x04'});
+    CHECK(encoder.encode(report) == expected);
+
+    // Postcard
+    report.postcard = true;
+    report.sequence = 0x1234;
+    expected.append({'\x20', '\x01', '\x28', '\xb4', '\x24'});
+    CHECK(encoder.encode(report) == expected);
+    report.postcard = false;
+
+    FlowIdentity flow;
+    CHECK(encoder.flowKey(flow).empty());
+    flow.flowId = 0xabcde;
+    expected.assign({'\x18', '\xde', '\xf9', '\x2a'});
+    CHECK(encoder.flowKey(flow) == expected);
+
+    // All fields, the ISD is not part of the AS number
+    flow.dstIsdAs = 0x0001000000000004ull;
+    flow.srcIsdAs = 0x0001000000000001ull;
+    flow.dstPort = 12345;
+    flow.srcPort = 80;
+    flow.protocol = 0x11;
+    flow.dstHostType = SCION_HOST_IPV4;
+    flow.dstHost = {std::byte{10}, std::byte{0}, std::byte{0}, std::byte{2}};
+    flow.srcHostType = SCION_HOST_IPV6;
+    flow.srcHost = {std::byte{0xfd}};
+    flow.srcHost[15] = std::byte{1};
+    expected.assign({'\x08', '\x04', '\x10', '\x01', '\x18', '\xde', '\xf9', '\x2a'});
+    expected.append({'\x25', '\x02', '\x00', '\x00', '\x0a'});
+    expected.append({'\x3a', '\x12', '\x09', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\xfd'});
+    expected.append({'\x11', '\x01', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00'});
+    expected.append({'\x40', '\xb9', '\x60', '\x48', '\x50', '\x50', '\x01'});
+    CHECK(encoder.flowKey(flow) == expected);
+
+    // Service addresses are not part of the key
+    flow.srcHostType = 0x4;
+    CHECK(encoder.flowKey(flow).size() == expected.size() - 20);
+}
+
 } // TEST_SUITE
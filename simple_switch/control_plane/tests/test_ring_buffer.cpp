@@ -0,0 +1,64 @@
+#include "ring_buffer.h"
+
+#include <doctest/doctest.h>
+
+#include <cstdint>
+#include <thread>
+
+
+TEST_SUITE("RingBuffer") {
+
+TEST_CASE("SpscRing")
+{
+    SpscRing<int> ring(2);
+
+    int value = 0;
+    CHECK(!ring.tryPop(value));
+    CHECK(ring.tryPush(1));
+    CHECK(ring.tryPush(2));
+    CHECK(!ring.tryPush(3));
+
+    CHECK(ring.pop() == 1);
+    CHECK(ring.tryPop(value));
+    CHECK(value == 2);
+    CHECK(!ring.tryPop(value));
+}
+
+TEST_CASE("SpscRing blocking")
+{
+    constexpr uint64_t COUNT = 100000;
+    SpscRing<uint64_t> ring(16);
+
+    std::thread producer([&ring] {
+        for (uint64_t i = 1; i <= COUNT; ++i)
+            ring.push(i);
+    });
+
+    // Elements arrive complete and in order even though the producer blocks on the full ring
+    bool inOrder = true;
+    for (uint64_t i = 1; i <= COUNT; ++i)
+        inOrder &= (ring.pop() == i);
+    producer.join();
+    CHECK(inOrder);
+}
+
+TEST_CASE("MpmcRing blocking")
+{
+    constexpr uint64_t COUNT = 50000;
+    MpmcRing<uint64_t> ring(16);
+
+    auto produce = [&ring] {
+        for (uint64_t i = 1; i <= COUNT; ++i)
+            ring.push(i);
+    };
+    std::thread producer1(produce), producer2(produce);
+
+    uint64_t sum = 0;
+    for (uint64_t i = 0; i < 2 * COUNT; ++i)
+        sum += ring.pop();
+    producer1.join();
+    producer2.join();
+    CHECK(sum == COUNT * (COUNT + 1));
+}
+
+}
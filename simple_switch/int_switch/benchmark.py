@@ -0,0 +1,430 @@
+# Compares the forwarding rate of simple_switch running the INT switch with the UDP checksum of the
+# underlay recomputed over the whole datagram (UDP_CHECKSUM_FULL) and updated incrementally.
+#
+# With --reports, the switch acts as INT sink instead and the rate is compared between reporting
+# INT stacks in packet-in clones sent to the CPU port and in digests. simple_switch_grpc is used
+# then. Like the controller, the benchmark installs the pipeline, the clone session and the batching
+# of digest lists (--digest-list-size, --digest-timeout, --digest-ack-timeout) over P4Runtime and
+# counts the packet-in messages and digests it receives. With --output, the median rates and the
+# parameters of the measurement are appended to a CSV file.
+#
+# Requires p4c, simple_switch, simple_switch_CLI, tcpreplay and scapy, and for --reports
+# simple_switch_grpc and the p4runtime and grpcio Python packages. Must be run as root, since it
+# creates veth pairs: sudo python3 benchmark.py
+
+import argparse
+import csv
+import os
+import queue
+import struct
+import subprocess
+import sys
+import tempfile
+import threading
+import time
+
+from scapy.all import Ether, IP, UDP, Raw, raw, sniff, wrpcap
+from scapy.utils import checksum
+
+
+P4_SRC = os.path.join(os.path.dirname(os.path.abspath(__file__)), "../data_plane/int_switch.p4")
+
+# Packets enter on veth0 (port 0) and leave on veth2 (port 1). veth1 and veth3 are the peers.
+# Clones to the CPU port are sent to the P4Runtime client as packet-in messages.
+INTERFACES = [("veth0", "veth1"), ("veth2", "veth3")]
+CPU_PORT = 128
+SRC_MAC = "00:00:00:00:00:01"
+DST_MAC = "00:00:00:00:00:02"
+DST_ISD, DST_AS = 1, 0xff0000000111
+SRC_ISD, SRC_AS = 1, 0xff0000000110
+
+VARIANTS = [("full", ["-DUDP_CHECKSUM_FULL"]), ("incremental", [])]
+# Action of the sink entry in the scion_int table
+REPORT_VARIANTS = [("packet-in", "clone_int"), ("digest", "digest_int")]
+
+# UDP port and domain ID signaling INT (UDP_PORT and SCION_DOMAIN_ID of the data plane)
+INT_UDP_PORT = 12345
+SCION_DOMAIN_ID = 0x0001
+# Node ID, level 1 interface IDs, hop latency and queue occupancy of every hop
+INT_INSTRUCTIONS = 0xf000
+INT_HOP_WORDS = 4
+
+# Digest of the INT sink (DIGEST_INT_NAME of the controller)
+DIGEST_INT_NAME = "intDigest_t"
+
+
+def int_headers(hops, dst_port):
+    """Build INT shim and MD headers followed by a stack of the given number of hops."""
+    stack = b"".join(struct.pack("!IIII", hop + 1, 0x00010002, 100 * (hop + 1), 0x00000010)
+        for hop in range(hops))
+    shim = bytes([0x10, 3 + len(stack) // 4]) + dst_port.to_bytes(2, "big")
+    md = struct.pack("!IHHHH", (2 << 28) | (INT_HOP_WORDS << 8) | 8, INT_INSTRUCTIONS,
+        SCION_DOMAIN_ID, 0, 0)
+    return shim + md + stack
+
+
+def scion_packet(payload_size, int_hops=0):
+    """Build a SCION/UDP packet with a one-hop path encapsulated in UDP/IPv4. If int_hops is
+    non-zero, the packet carries an INT stack with that many hops."""
+    payload = bytes(payload_size)
+    dst_port = 30042
+    if int_hops:
+        payload = int_headers(int_hops, dst_port) + payload
+        dst_port = INT_UDP_PORT
+    udp_scion = (30041).to_bytes(2, "big") + dst_port.to_bytes(2, "big") \
+        + (8 + len(payload)).to_bytes(2, "big") + bytes(2)
+    # Info field and two hop fields
+    path = bytes(8 + 2 * 12)
+    hosts = bytes([10, 0, 0, 2, 10, 0, 0, 1])
+    addr = DST_ISD.to_bytes(2, "big") + DST_AS.to_bytes(6, "big") \
+        + SRC_ISD.to_bytes(2, "big") + SRC_AS.to_bytes(6, "big")
+    hdr_len = 12 + len(addr) + len(hosts) + len(path)
+    common = bytes([0x00, 0x00, 0x00, 0x01, 0x11, hdr_len // 4]) \
+        + (len(udp_scion) + len(payload)).to_bytes(2, "big") \
+        + bytes([0x02, 0x00]) + bytes(2)
+    scion = common + addr + hosts + path + udp_scion + payload
+    return Ether(src=SRC_MAC, dst=DST_MAC) / IP(src="192.168.0.1", dst="192.168.0.2") \
+        / UDP(sport=50000, dport=50000) / Raw(scion)
+
+
+def run(cmd, **kwargs):
+    return subprocess.run(cmd, check=True, **kwargs)
+
+
+def setup_interfaces():
+    for intf, peer in INTERFACES:
+        subprocess.run(["ip", "link", "del", intf], stderr=subprocess.DEVNULL)
+        run(["ip", "link", "add", intf, "type", "veth", "peer", "name", peer])
+        for name in (intf, peer):
+            run(["ip", "link", "set", name, "mtu", "9000", "up"])
+            run(["sysctl", "-q", "net.ipv6.conf.{}.disable_ipv6=1".format(name)])
+
+
+def teardown_interfaces():
+    for intf, _ in INTERFACES:
+        subprocess.run(["ip", "link", "del", intf], stderr=subprocess.DEVNULL)
+
+
+def compile_variant(build_dir, name, flags):
+    """Compile the data plane. Returns the paths of the bmv2 JSON and the P4Info."""
+    out_dir = os.path.join(build_dir, name)
+    p4info = os.path.join(out_dir, "p4info.txt")
+    run(["p4c", "--target", "bmv2", "--arch", "v1model", "-o", out_dir,
+        "--p4runtime-files", p4info] + flags + [P4_SRC])
+    return os.path.join(out_dir, "int_switch.json"), p4info
+
+
+def configure_switch(thrift_port, instruction_bitmap, sink_action=None):
+    if sink_action:
+        # Report INT stacks of packets to the local AS. The clone session is written over P4Runtime.
+        commands = "\n".join([
+            "table_add MyIngress.l2switch.learn_table no_action {}".format(SRC_MAC),
+            "table_add MyIngress.l2switch.forward_table MyIngress.l2switch.forward {} => 1"
+                .format(DST_MAC),
+            "table_add MyIngress.intswitch.scion_int MyIngress.intswitch.{} {} {} =>"
+                .format(sink_action, DST_ISD, DST_AS),
+        ])
+        run(["simple_switch_CLI", "--thrift-port", str(thrift_port)], input=commands.encode(),
+            stdout=subprocess.DEVNULL)
+        return
+
+    commands = "\n".join([
+        "table_add MyIngress.l2switch.learn_table no_action {}".format(SRC_MAC),
+        "table_add MyIngress.l2switch.forward_table MyIngress.l2switch.forward {} => 1".format(DST_MAC),
+        "table_add MyIngress.intswitch.scion_int MyIngress.intswitch.insert_int {} {} => {} 0x0001 0 1"
+            .format(DST_ISD, DST_AS, instruction_bitmap),
+        "table_add MyEgress.intswitch.int_node_id_table MyEgress.intswitch.insert_int_node_id 1 => 1",
+        "table_add MyEgress.intswitch.sci_as_addr_table MyEgress.intswitch.insert_sci_as_addr 1 => {}"
+            .format((DST_ISD << 48) | DST_AS),
+    ])
+    run(["simple_switch_CLI", "--thrift-port", str(thrift_port)], input=commands.encode(),
+        stdout=subprocess.DEVNULL)
+
+
+def rx_packets(intf):
+    with open("/sys/class/net/{}/statistics/rx_packets".format(intf)) as f:
+        return int(f.read())
+
+
+def udp_checksum_ok(pkt):
+    """Verify the UDP checksum of the underlay over the pseudo header and the whole datagram."""
+    ip, udp = pkt[IP], raw(pkt[UDP])
+    if int.from_bytes(udp[6:8], "big") == 0:
+        return True
+    pseudo = raw(ip)[12:20] + bytes([0, ip.proto]) + len(udp).to_bytes(2, "big")
+    return checksum(pseudo + udp) == 0
+
+
+class P4RuntimeClient:
+    """Primary controller of the switch over P4Runtime. Installs the pipeline and configures the
+    clone session and the INT digest like the controller does. Counts the packet-in messages and
+    digests it receives and acknowledges every digest list, so that the switch does not hold back
+    digests it has sent before."""
+
+    def __init__(self, grpc_addr, config, p4info_path):
+        import grpc
+        from google.protobuf import text_format
+        from p4.config.v1 import p4info_pb2
+        from p4.v1 import p4runtime_pb2, p4runtime_pb2_grpc
+        self.grpc = grpc
+        self.pb = p4runtime_pb2
+        self.channel = grpc.insecure_channel(grpc_addr)
+        self.stub = p4runtime_pb2_grpc.P4RuntimeStub(self.channel)
+        self.election_id = p4runtime_pb2.Uint128(high=0, low=1)
+        self.p4info = p4info_pb2.P4Info()
+        with open(p4info_path) as f:
+            text_format.Merge(f.read(), self.p4info)
+        self.packet_ins = 0
+        self.digests = 0
+        self.lists = 0
+
+        # Become primary controller
+        self.requests = queue.Queue()
+        self.stream = self.stub.StreamChannel(iter(self.requests.get, None))
+        request = p4runtime_pb2.StreamMessageRequest()
+        request.arbitration.device_id = 0
+        request.arbitration.election_id.CopyFrom(self.election_id)
+        self.requests.put(request)
+        response = next(self.stream)
+        if response.arbitration.status.code != grpc.StatusCode.OK.value[0]:
+            raise RuntimeError("Not elected as primary controller")
+
+        request = p4runtime_pb2.SetForwardingPipelineConfigRequest(device_id=0,
+            election_id=self.election_id,
+            action=p4runtime_pb2.SetForwardingPipelineConfigRequest.VERIFY_AND_COMMIT)
+        request.config.p4info.CopyFrom(self.p4info)
+        with open(config, "rb") as f:
+            request.config.p4_device_config = f.read()
+        self.stub.SetForwardingPipelineConfig(request)
+
+        self.thread = threading.Thread(target=self.run, daemon=True)
+        self.thread.start()
+
+    def write(self, entity):
+        request = self.pb.WriteRequest(device_id=0, election_id=self.election_id)
+        update = request.updates.add()
+        update.type = self.pb.Update.INSERT
+        update.entity.CopyFrom(entity)
+        self.stub.Write(request)
+
+    def write_clone_session(self, session_id, port):
+        entity = self.pb.Entity()
+        session = entity.packet_replication_engine_entry.clone_session_entry
+        session.session_id = session_id
+        replica = session.replicas.add()
+        replica.egress_port = port
+        replica.instance = 1
+        self.write(entity)
+
+    def write_digest(self, name, max_list_size, max_timeout_us, ack_timeout_us):
+        ids = [digest.preamble.id for digest in self.p4info.digests if digest.preamble.name == name]
+        if not ids:
+            raise RuntimeError("Digest {} not found in the P4Info".format(name))
+        entity = self.pb.Entity()
+        entity.digest_entry.digest_id = ids[0]
+        entity.digest_entry.config.max_list_size = max_list_size
+        entity.digest_entry.config.max_timeout_ns = max_timeout_us * 1000
+        entity.digest_entry.config.ack_timeout_ns = ack_timeout_us * 1000
+        self.write(entity)
+
+    def run(self):
+        try:
+            for response in self.stream:
+                if response.HasField("packet"):
+                    self.packet_ins += 1
+                elif response.HasField("digest"):
+                    self.digests += len(response.digest.data)
+                    self.lists += 1
+                    ack = self.pb.StreamMessageRequest()
+                    ack.digest_ack.digest_id = response.digest.digest_id
+                    ack.digest_ack.list_id = response.digest.list_id
+                    self.requests.put(ack)
+        except self.grpc.RpcError:
+            # The stream is closed when the switch terminates
+            pass
+
+    def close(self):
+        self.requests.put(None)
+        self.channel.close()
+
+
+def measure(config, pcap, args, sink_action=None):
+    """Start the switch, replay the packets and return the rate seen on the egress interface and
+    the rate of reports sent to the controller. config is the path of the bmv2 JSON, for the INT
+    sink a tuple of the JSON and the P4Info installed over P4Runtime."""
+    switch_path = "simple_switch_grpc" if sink_action else "simple_switch"
+    cmd = [switch_path, "--thrift-port", str(args.thrift_port), "--log-level", "off"]
+    for port, (intf, _) in enumerate(INTERFACES):
+        cmd += ["-i", "{}@{}".format(port, intf)]
+    if sink_action:
+        grpc_addr = "localhost:{}".format(args.grpc_port)
+        cmd += ["--no-p4", "--", "--grpc-server-addr", grpc_addr, "--cpu-port", str(CPU_PORT)]
+    else:
+        cmd += [config]
+    switch = subprocess.Popen(cmd, stdout=subprocess.DEVNULL)
+    client = None
+    try:
+        time.sleep(2)
+        if sink_action:
+            client = P4RuntimeClient(grpc_addr, *config)
+            client.write_clone_session(1, CPU_PORT)
+            if sink_action == "digest_int":
+                client.write_digest(DIGEST_INT_NAME, args.digest_list_size, args.digest_timeout,
+                    args.digest_ack_timeout)
+        configure_switch(args.thrift_port, args.instruction_bitmap, sink_action)
+
+        # Check a few forwarded packets before the measurement
+        sniffer = subprocess.Popen([sys.executable, "-c",
+            "from scapy.all import sniff, wrpcap; "
+            "wrpcap('{0}.out', sniff(iface='veth3', count=10, timeout=5, "
+            "filter='udp and dst port 50000'))".format(pcap)])
+        time.sleep(1)
+        run(["tcpreplay", "-q", "-i", "veth1", "-L", "10", pcap], stdout=subprocess.DEVNULL)
+        sniffer.wait()
+        captured = sniff(offline=pcap + ".out")
+        valid = sum(udp_checksum_ok(pkt) for pkt in captured)
+
+        def reports():
+            if sink_action == "clone_int":
+                return client.packet_ins
+            return client.digests if client else 0
+
+        start = rx_packets(INTERFACES[1][1])
+        replay = subprocess.Popen(["tcpreplay", "-q", "--topspeed", "-i", "veth1",
+            "--loop", "0", pcap], stdout=subprocess.DEVNULL, stderr=subprocess.DEVNULL)
+        time.sleep(args.warmup)
+        begin, reports_begin, t0 = rx_packets(INTERFACES[1][1]), reports(), time.monotonic()
+        time.sleep(args.duration)
+        end, reports_end, t1 = rx_packets(INTERFACES[1][1]), reports(), time.monotonic()
+        replay.terminate()
+        replay.wait()
+
+        if end == start:
+            raise RuntimeError("No packets were forwarded, check the table entries")
+        return (end - begin) / (t1 - t0), (reports_end - reports_begin) / (t1 - t0), \
+            valid, len(captured)
+    finally:
+        if client:
+            client.close()
+        switch.terminate()
+        switch.wait()
+
+
+def benchmark_checksum(args, build_dir):
+    configs = [(name, compile_variant(build_dir, name, flags)[0]) for name, flags in VARIANTS]
+    pcap = os.path.join(build_dir, "packets.pcap")
+    wrpcap(pcap, [scion_packet(args.payload)])
+
+    setup_interfaces()
+    try:
+        results = {}
+        for name, config in configs:
+            rates = []
+            for i in range(args.runs):
+                rate, _, valid, captured = measure(config, pcap, args)
+                print("{}: run {}: {:.0f} pps, {}/{} checksums valid".format(
+                    name, i + 1, rate, valid, captured))
+                rates.append(rate)
+            results[name] = sorted(rates)[len(rates) // 2]
+    finally:
+        teardown_interfaces()
+
+    for name, _ in VARIANTS:
+        print("{:12} {:10.0f} pps (median)".format(name, results[name]))
+    print("Speedup: {:.2f}".format(results["incremental"] / results["full"]))
+
+
+def benchmark_reports(args, build_dir):
+    config = compile_variant(build_dir, "sink", [])
+    pcap = os.path.join(build_dir, "packets.pcap")
+    # Vary the hop latency, so that bmv2 does not suppress digests with identical content
+    packets = [scion_packet(args.payload, args.int_hops) for _ in range(256)]
+    for i, pkt in enumerate(packets):
+        data = bytearray(raw(pkt))
+        offset = len(data) - args.payload - 16 * args.int_hops + 8
+        data[offset:offset + 4] = (100 + i).to_bytes(4, "big")
+        packets[i] = Ether(bytes(data))
+    wrpcap(pcap, packets)
+
+    setup_interfaces()
+    try:
+        results = {}
+        for name, action in REPORT_VARIANTS:
+            rates = []
+            for i in range(args.runs):
+                rate, report_rate, valid, captured = measure(config, pcap, args, action)
+                print("{}: run {}: {:.0f} pps, {:.0f} reports/s, {}/{} checksums valid".format(
+                    name, i + 1, rate, report_rate, valid, captured))
+                rates.append((rate, report_rate))
+            results[name] = sorted(rates)[len(rates) // 2]
+    finally:
+        teardown_interfaces()
+
+    for name, _ in REPORT_VARIANTS:
+        print("{:12} {:10.0f} pps {:10.0f} reports/s (median)".format(name, *results[name]))
+    print("Speedup: {:.2f}".format(results["digest"][0] / results["packet-in"][0]))
+    if args.output:
+        record_results(args, results)
+
+
+def record_results(args, results):
+    """Append the median rates of the report variants and the parameters of the measurement to a
+    CSV file."""
+    fields = ["variant", "pps", "reports_per_s", "payload", "int_hops", "digest_list_size",
+        "digest_timeout_us", "digest_ack_timeout_us", "duration", "runs"]
+    new_file = not os.path.exists(args.output)
+    with open(args.output, "a", newline="") as f:
+        writer = csv.writer(f)
+        if new_file:
+            writer.writerow(fields)
+        for name, _ in REPORT_VARIANTS:
+            rate, report_rate = results[name]
+            writer.writerow([name, round(rate), round(report_rate), args.payload, args.int_hops,
+                args.digest_list_size, args.digest_timeout, args.digest_ack_timeout,
+                args.duration, args.runs])
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Compare the forwarding rate of full and incremental UDP checksum updates or of "
+            "packet-in and digest reports.")
+    parser.add_argument("--payload", type=int, default=1000,
+        help="Size of the SCION/UDP payload in bytes. (Default: 1000)")
+    parser.add_argument("--duration", type=float, default=10,
+        help="Measurement interval in seconds. (Default: 10)")
+    parser.add_argument("--warmup", type=float, default=2,
+        help="Time to wait before the measurement starts in seconds. (Default: 2)")
+    parser.add_argument("--runs", type=int, default=3,
+        help="Number of measurements per variant. (Default: 3)")
+    parser.add_argument("--instruction-bitmap", default="0x8c00",
+        help="INT instruction bitmap inserted by the switch. (Default: 0x8c00)")
+    parser.add_argument("--thrift-port", type=int, default=9090,
+        help="Thrift port of the switch. (Default: 9090)")
+    parser.add_argument("--reports", action="store_true",
+        help="Compare packet-in and digest reports of the INT sink instead of UDP checksum updates.")
+    parser.add_argument("--int-hops", type=int, default=4,
+        help="Number of hops in the INT stack of packets to the sink. (Default: 4)")
+    parser.add_argument("--grpc-port", type=int, default=9559,
+        help="P4Runtime port of the switch acting as INT sink. (Default: 9559)")
+    parser.add_argument("--digest-list-size", type=int, default=64,
+        help="Maximum number of digests in a list. (Default: 64)")
+    parser.add_argument("--digest-timeout", type=int, default=1000,
+        help="Maximum time a digest waits for more digests in us. (Default: 1000)")
+    parser.add_argument("--digest-ack-timeout", type=int, default=10000,
+        help="Time the switch waits for the acknowledgement of a digest list in us. "
+            "(Default: 10000)")
+    parser.add_argument("--output", default=None,
+        help="Append the median rates of packet-in and digest reports to this CSV file.")
+    args = parser.parse_args()
+
+    if os.geteuid() != 0:
+        sys.exit("Must be run as root")
+
+    with tempfile.TemporaryDirectory() as build_dir:
+        if args.reports:
+            benchmark_reports(args, build_dir)
+        else:
+            benchmark_checksum(args, build_dir)
+
+if __name__ == '__main__':
+    main()
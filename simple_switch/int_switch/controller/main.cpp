@@ -4,31 +4,227 @@
 #include "controllers/mac_learn.h"
 #include "controllers/int/int.h"
 
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstdlib>
 #include <iostream>
+#include <limits>
 #include <stdexcept>
+#include <string>
+#include <vector>
 
 
+static void printUsage(const char* prog)
+{
+    std::cout << "Usage: " << prog
+        << " [options] <p4Info file> <config file> <switch address> <device id> <election id> <as address> <node id> <int table> <Kafka broker address> [<tcp address>]\n"
+        << "Options:\n"
+        << "  --sink <type>=<address>       Additional report sink, may be repeated. Types: kafka (brokers),\n"
+        << "                                tcp, udp (ip:port), unix (socket path), file (path)\n"
+        << "  --workers <n>                 Handle packet-in messages on n worker threads (default: 0)\n"
+        << "  --queue-depth <n>             Capacity of the packet-in queue of each worker (default: 1024)\n"
+        << "  --write-window <n>            Maximum number of write requests in flight (default: 16)\n"
+        << "  --write-max-bytes <bytes>     Split larger write requests (default: 1048576)\n"
+        << "  --reconnect <0|1>             Reconnect if the stream to the switch breaks (default: 1)\n"
+        << "  --keepalive-interval <ms>     Interval of switch liveness probes (default: 200, 0 is off)\n"
+        << "  --keepalive-timeout <ms>      A probe fails if it is not answered in time (default: 1000)\n"
+        << "  --keepalive-failures <n>      Reconnect after n consecutive failed probes (default: 3)\n"
+        << "  --reconnect-backoff <ms>      Maximum time between reconnection attempts (default: 500)\n"
+        << "  --kafka-linger-ms <ms>        Time to wait for more reports before sending a batch (default: 5)\n"
+        << "  --kafka-batch-size <bytes>    Maximum size of a batch (default: 1048576)\n"
+        << "  --kafka-compression <codec>   none, gzip, snappy, lz4 or zstd (default: lz4)\n"
+        << "  --kafka-queue-size <n>        Reports buffered before reports are dropped (default: 100000)\n"
+        << "  --kafka-stats-interval <s>    Print exporter statistics every s seconds (default: 0, off)\n"
+        << "  --kafka-spool <dir>           Spool reports in dir while the broker is unreachable (default: off)\n"
+        << "  --kafka-spool-size <MiB>      Maximum size of the spool (default: 1024)\n"
+        << "  --kafka-replay-rate <n>       Reports per second replayed from the spool (default: 10000)\n"
+        << "  --kafka-partitions <n>        Spread flows over n partitions per topic (default: 0, broker decides)\n"
+        << "  --kafka-create-topics <0|1>   Create missing topics with the given partitions (default: 0)\n"
+        << "  --kafka-replication <n>       Replication factor of created topics (default: 1)\n"
+        << "  --tx-util-interval <ms>       Interval of utilization table updates, TX_UTIL_TABLE builds only\n"
+        << "                                (default: 1000, 0 is off)\n"
+        << "  --tx-util-threshold <kbit/s>  Minimum change of the utilization to update a port (default: 100)\n"
+        << "  --int-max-hops <n>            Maximum number of INT hops after the source, NUM_INTER_HOPS of the\n"
+        << "                                data plane (default: 10)\n"
+        << "  --max-scion-header <bytes>    Maximum length of SCION headers (default: 1020)\n"
+        << "  --int-mtu <bytes>             Do not add INT to IP packets that would exceed this size\n"
+        << "                                (default: 0, no limit)\n"
+        << "  --int-mtu-interval <ms>       Interval of MTU exceeded counter reads (default: 10000, 0 is off)\n"
+        << "  --report-refresh <ms>         Report a flow only on changes or after this interval\n"
+        << "                                (default: 0, report every packet)\n"
+        << "  --report-latency-delta <us>   Change of the hop latency that triggers a report (default: 0)\n"
+        << "  --report-queue-delta <n>      Change of the queue occupancy that triggers a report (default: 0)\n"
+        << "  --int-digest <0|1>            Report the first hop of INT stacks in digests instead of packet-in\n"
+        << "                                messages (default: 0)\n"
+        << "  --digest-list-size <n>        Maximum number of digests in a list (default: 64)\n"
+        << "  --digest-timeout <us>         Maximum time a digest waits for a list to fill up (default: 1000)\n"
+        << "  --digest-ack-timeout <us>     Time before unacknowledged digests are sent again (default: 10000)\n";
+}
+
+/// \brief Parse the value of a numeric command line option.
+/// \param[in] max Largest valid value.
+/// \exception std::invalid_argument The value is not a non-negative decimal number or too large.
+static unsigned long long parseNumber(const std::string& option, const char* value,
+    unsigned long long max = std::numeric_limits<unsigned long long>::max())
+{
+    errno = 0;
+    char* end = nullptr;
+    auto number = std::strtoull(value, &end, 10);
+    bool negative = std::string(value).find('-') != std::string::npos;
+    if (end == value || *end != '\0' || negative || errno == ERANGE || number > max)
+        throw std::invalid_argument("Invalid value of " + option + ": " + value);
+    return number;
+}
+
 int main(int argc, char* argv[])
 {
     // TODO: Better command line parsing
-    if (argc < 10 || argc > 11)
+    std::vector<const char*> args;
+    size_t workers = 0;
+    size_t queueDepth = 1024;
+    WriteConfig writeConfig;
+    ReconnectConfig reconnectConfig;
+    KafkaConfig kafkaConfig;
+    TxUtilConfig txUtilConfig;
+    CloneConfig cloneConfig;
+    MtuConfig mtuConfig;
+    ReportFilterConfig reportFilterConfig;
+    DigestConfig digestConfig;
+    std::vector<SinkConfig> sinks;
+    for (int i = 1; i < argc; ++i)
     {
-        std::cout << "Usage: " << argv[0]
-            << " <p4Info file> <config file> <switch address> <device id> <election id> <as address> <node id> <int table> <Kafka broker address> [<tcp address>]\n";
-        return 0;
+        std::string arg = argv[i];
+        if (arg.starts_with("--") && i + 1 < argc)
+        {
+            const char* value = argv[++i];
+            auto number = [&](unsigned long long max = std::numeric_limits<unsigned long long>::max()) {
+                return parseNumber(arg, value, max);
+            };
+            constexpr auto U32 = std::numeric_limits<uint32_t>::max();
+            constexpr auto I32 = std::numeric_limits<int32_t>::max();
+            try {
+                if (arg == "--sink")
+                    sinks.push_back(parseSinkConfig(value));
+                else if (arg == "--workers")
+                    workers = number();
+                else if (arg == "--queue-depth")
+                    queueDepth = number();
+                else if (arg == "--write-window")
+                    writeConfig.maxInFlight = std::max<size_t>(number(), 1);
+                else if (arg == "--write-max-bytes")
+                    writeConfig.maxRequestBytes = number();
+                else if (arg == "--reconnect")
+                    reconnectConfig.enabled = number() != 0;
+                else if (arg == "--keepalive-interval")
+                    reconnectConfig.keepaliveInterval = std::chrono::milliseconds(number());
+                else if (arg == "--keepalive-timeout")
+                    reconnectConfig.keepaliveTimeout = std::chrono::milliseconds(number());
+                else if (arg == "--keepalive-failures")
+                    reconnectConfig.keepaliveFailures = std::max<size_t>(number(), 1);
+                else if (arg == "--reconnect-backoff")
+                    reconnectConfig.maxBackoff = std::chrono::milliseconds(
+                        std::max<size_t>(number(), reconnectConfig.minBackoff.count()));
+                else if (arg == "--kafka-linger-ms")
+                    kafkaConfig.lingerMs = number(U32);
+                else if (arg == "--kafka-batch-size")
+                    kafkaConfig.batchSize = number(U32);
+                else if (arg == "--kafka-compression")
+                    kafkaConfig.compression = value;
+                else if (arg == "--kafka-queue-size")
+                    kafkaConfig.maxQueuedReports = number(U32);
+                else if (arg == "--kafka-stats-interval")
+                    kafkaConfig.statsInterval = std::chrono::seconds(number());
+                else if (arg == "--kafka-spool")
+                    kafkaConfig.spoolDirectory = value;
+                else if (arg == "--kafka-spool-size")
+                    kafkaConfig.spoolMaxBytes = number(std::numeric_limits<size_t>::max() >> 20) << 20;
+                else if (arg == "--kafka-replay-rate")
+                    kafkaConfig.replayRate = number(U32);
+                else if (arg == "--kafka-partitions")
+                    kafkaConfig.partitions = number(I32);
+                else if (arg == "--kafka-create-topics")
+                    kafkaConfig.createTopics = number() != 0;
+                else if (arg == "--kafka-replication")
+                    kafkaConfig.replicationFactor = number(I32);
+                else if (arg == "--tx-util-interval")
+                    txUtilConfig.interval = std::chrono::milliseconds(number());
+                else if (arg == "--tx-util-threshold")
+                    txUtilConfig.threshold = number(std::numeric_limits<LinkUtil>::max());
+                else if (arg == "--int-max-hops")
+                    cloneConfig.maxHops = number(U32);
+                else if (arg == "--max-scion-header")
+                    cloneConfig.maxScionHeaderBytes = number(U32);
+                else if (arg == "--int-mtu")
+                    mtuConfig.mtu = number(std::numeric_limits<Mtu>::max());
+                else if (arg == "--int-mtu-interval")
+                    mtuConfig.interval = std::chrono::milliseconds(number());
+                else if (arg == "--report-refresh")
+                    reportFilterConfig.refresh = std::chrono::milliseconds(number());
+                else if (arg == "--report-latency-delta")
+                    reportFilterConfig.latencyDelta = number(U32);
+                else if (arg == "--report-queue-delta")
+                    reportFilterConfig.queueDelta = number(U32);
+                else if (arg == "--int-digest")
+                    digestConfig.enabled = number() != 0;
+                else if (arg == "--digest-list-size")
+                    digestConfig.maxListSize = number(U32);
+                else if (arg == "--digest-timeout")
+                    digestConfig.maxTimeout = std::chrono::microseconds(number());
+                else if (arg == "--digest-ack-timeout")
+                    digestConfig.ackTimeout = std::chrono::microseconds(number());
+                else
+                {
+                    std::cout << "Error: Unknown option " << arg << '\n';
+                    printUsage(argv[0]);
+                    return 1;
+                }
+            }
+            catch (std::exception &e) {
+                std::cout << "Error: " << e.what() << '\n';
+                return 1;
+            }
+        }
+        else if (arg.starts_with("--"))
+        {
+            std::cout << "Error: Option " << arg << " requires a value\n";
+            printUsage(argv[0]);
+            return 1;
+        }
+        else
+        {
+            args.push_back(argv[i]);
+        }
+    }
+
+    if (args.size() < 9 || args.size() > 10)
+    {
+        printUsage(argv[0]);
+        return 1;
+    }
+    if (workers > 0 && (queueDepth == 0
+        || queueDepth > ControlPlane::MAX_PIPELINE_MESSAGES / (workers + 1)))
+    {
+        std::cout << "Error: --queue-depth must be at least 1 and (workers + 1) * queue depth at most "
+            << ControlPlane::MAX_PIPELINE_MESSAGES << '\n';
+        return 1;
     }
     try {
         ControlPlane control(
-            std::make_unique<SwitchConnection>(argv[3], std::atoi(argv[4]), std::atoll(argv[5])),
-            loadP4Info(argv[1]),
-            loadDeviceConfig(argv[2])
+            std::make_unique<SwitchConnection>(args[2], std::atoi(args[3]), std::atoll(args[4]),
+                writeConfig, reconnectConfig),
+            loadP4Info(args[0]),
+            loadDeviceConfig(args[1])
         );
         control.addController<DefaultController>();
         control.addController<MacLearningCtrl>();
-        if (argc == 10)
-            control.addController<IntController>(argv[6], std::atoi(argv[7]), argv[8], argv[9], "");
-        if (argc == 11)
-            control.addController<IntController>(argv[6], std::atoi(argv[7]), argv[8], argv[9], argv[10]);
+        sinks.push_back(SinkConfig{"kafka", args[8]});
+        if (args.size() == 10)
+            sinks.push_back(SinkConfig{"tcp", args[9]});
+        control.addController<IntController>(args[5], std::atoi(args[6]), args[7], sinks, kafkaConfig,
+            TcpConfig(), txUtilConfig, cloneConfig, mtuConfig, reportFilterConfig, digestConfig);
+        if (workers > 0)
+            control.setPipeline(workers, queueDepth, &IntController::flowHash);
         control.run();
         return 0;
     }
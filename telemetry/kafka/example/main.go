@@ -45,15 +45,21 @@ func runConsumer(server string) {
 	}
 	defer c.Close()
 
-	// Subscribe to reports from all ASes
-	c.SubscribeTopics([]string{"ASff00_0_1-1", "ASff00_0_2-1", "ASff00_0_3-1", "ASff00_0_4-1", "ASff00_0_5-1", "ASff00_0_6-1", "ASff00_0_7-1"}, nil)
+	// Subscribe to reports from all ASes. Postcards of all switches have a topic of their own.
+	var subscriptions []string
+	for as := 1; as <= 7; as++ {
+		subscriptions = append(subscriptions,
+			fmt.Sprintf("ASff00_0_%x-1", as), fmt.Sprintf("ASff00_0_%x-postcards", as))
+	}
+	c.SubscribeTopics(subscriptions, nil)
 
 	// Read reports and print them
+	postcards := newPostcardCollector(maxPendingPackets)
 	for {
 		msg, err := c.ReadMessage(-1)
 		if err == nil {
 			fmt.Printf("Message on %s:\n", msg.TopicPartition)
-			err := printReport(msg.Key, msg.Value)
+			err := printReport(msg.Key, msg.Value, postcards)
 			if err != nil {
 				fmt.Printf("Error: %v\n", err)
 			}
@@ -63,7 +69,7 @@ func runConsumer(server string) {
 	}
 }
 
-func printReport(rawKey []byte, rawValue []byte) error {
+func printReport(rawKey []byte, rawValue []byte, postcards *postcardCollector) error {
 	var (
 		err   error
 		key   report.FlowKey
@@ -81,11 +87,65 @@ func printReport(rawKey []byte, rawValue []byte) error {
 	}
 
 	fmt.Printf("Flow key: %s\n", key.String())
-	fmt.Printf("Report: %s\n", value.String())
+	if value.Postcard {
+		// Print all hops of the packet received so far
+		merged := postcards.add(string(rawKey), &value)
+		fmt.Printf("Postcards (%d hops): %s\n", len(merged.Hops), merged.String())
+	} else {
+		fmt.Printf("Report: %s\n", value.String())
+	}
 
 	return nil
 }
 
+// Maximum number of packets for which postcards are collected
+const maxPendingPackets = 4096
+
+type postcardID struct {
+	key      string
+	sequence uint32
+}
+
+// Merges the postcards of the switches on the path of a packet into a single report. Postcards
+// of the same packet have the same flow key and sequence number. All switches publish the
+// postcards for a destination AS to the same topic and the postcards of a flow to the same
+// partition, so they are received by the same consumer.
+type postcardCollector struct {
+	maxPackets int
+	packets    map[postcardID]*report.Report
+	order      []postcardID
+}
+
+func newPostcardCollector(maxPackets int) *postcardCollector {
+	return &postcardCollector{
+		maxPackets: maxPackets,
+		packets:    make(map[postcardID]*report.Report),
+	}
+}
+
+// Add a postcard and return the merged report of its packet.
+func (c *postcardCollector) add(key string, postcard *report.Report) *report.Report {
+	id := postcardID{key, postcard.Sequence}
+	merged, ok := c.packets[id]
+	if !ok {
+		// Forget the oldest packet
+		if len(c.order) >= c.maxPackets {
+			delete(c.packets, c.order[0])
+			c.order = c.order[1:]
+		}
+		merged = &report.Report{
+			PacketType:      postcard.PacketType,
+			TruncatedPacket: postcard.TruncatedPacket,
+			Postcard:        true,
+			Sequence:        postcard.Sequence,
+		}
+		c.packets[id] = merged
+		c.order = append(c.order, id)
+	}
+	merged.Hops = append(merged.Hops, postcard.Hops...)
+	return merged
+}
+
 func runProducer(numEvents int, numFlows int, server string) {
 	// Open connection to Kafka broker
 	p, err := kafka.NewProducer(&kafka.ConfigMap{